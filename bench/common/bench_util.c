@@ -0,0 +1,10 @@
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+
+#include "bench_util.h"
+
+double bench_now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,10 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+// Outils communs aux benchmarks (le générateur pseudo-aléatoire est
+// gen_next_rand, dans test/common/graph_gen.h)
+
+// Temps écoulé en secondes (horloge monotone)
+double bench_now_sec(void);
+
+#endif
@@ -0,0 +1,130 @@
+// Benchmark de dist_power / stationary_distribution (produit vecteur × matrice dense)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "matrix.h"
+#include "mx_kernels.h"
+#include "graph_gen.h"
+#include "bench_util.h"
+
+/**
+ * @brief  Matrice stochastique n×n pseudo-aléatoire, non nulle sur une bande
+ *
+ * La ligne i n'a de transitions que vers [i - band, i + band] : partant d'un
+ * sommet, la masse se diffuse progressivement (lignes de masse nulle).
+ */
+static t_matrix banded_matrix(int n, int band) {
+    t_matrix M = mx_zeros(n);
+    unsigned seed = 3u;
+    for (int i = 0; i < n; ++i) {
+        float sum = 0.0f;
+        for (int j = i - band; j <= i + band; ++j) {
+            if (j < 0 || j >= n) continue;
+            M.a[i][j] = 1.0f + (float)(gen_next_rand(&seed) % 100u);
+            sum += M.a[i][j];
+        }
+        for (int j = 0; j < n; ++j) M.a[i][j] /= sum;
+    }
+    return M;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--min N] [--max N] [--steps T] [--band B]\n"
+        "  --min N     Plus petite taille (def 256)\n"
+        "  --max N     Plus grande taille (def 8192), tailles doublées\n"
+        "  --steps T   Nombre d'étapes par mesure (def 50)\n"
+        "  --band B    Demi-largeur de bande des transitions (def 16)\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int n_min = 256, n_max = 8192, steps = 50, band = 16;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--min") && i + 1 < argc) {
+            n_min = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--max") && i + 1 < argc) {
+            n_max = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--steps") && i + 1 < argc) {
+            steps = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--band") && i + 1 < argc) {
+            band = atoi(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (n_min < 1 || n_max < n_min || steps < 1 || band < 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    const t_mx_kernel best = mx_kernel_active();
+    const t_mx_kernel kernels[] = {MX_KERNEL_NAIVE, MX_KERNEL_PORTABLE, best};
+    const int nkernels = (best == MX_KERNEL_PORTABLE) ? 2 : 3;
+
+    printf("=== BENCH dist_step (pi1 = pi0 x M dense, %d étapes) ===\n", steps);
+    printf("%6s  %-9s %16s %16s %9s  %s\n", "n", "noyau", "dist_power (ms)", "stationary (ms)", "vs naive", "résultat");
+
+    int mismatches = 0;
+    for (int n = n_min; n <= n_max; n *= 2) {
+        t_matrix M = banded_matrix(n, band);
+        float *pi0 = (float *)calloc((size_t)n, sizeof(float));
+        float *pit = (float *)calloc((size_t)n, sizeof(float));
+        float *ref_pit = (float *)calloc((size_t)n, sizeof(float));
+        float *pis = (float *)calloc((size_t)n, sizeof(float));
+        float *ref_pis = (float *)calloc((size_t)n, sizeof(float));
+        if (!pi0 || !pit || !ref_pit || !pis || !ref_pis) {
+            perror("calloc");
+            return 1;
+        }
+        pi0[n / 2] = 1.0f; // départ d'un sommet : masse localisée
+
+        double t_naive = 0.0;
+        for (int k = 0; k < nkernels; ++k) {
+            mx_kernel_select(kernels[k]);
+
+            double start = bench_now_sec();
+            dist_power(pi0, &M, steps, pit);
+            double t_dist = bench_now_sec() - start;
+
+            start = bench_now_sec();
+            stationary_distribution(&M, 0.0f, steps, pis); // eps = 0 : exactement 'steps' itérations
+            double t_stat = bench_now_sec() - start;
+
+            // Le noyau naïf sert de référence (identité bit à bit)
+            const char *check = "référence";
+            if (k == 0) {
+                t_naive = t_dist + t_stat;
+                memcpy(ref_pit, pit, (size_t)n * sizeof(float));
+                memcpy(ref_pis, pis, (size_t)n * sizeof(float));
+            } else if (memcmp(ref_pit, pit, (size_t)n * sizeof(float)) == 0
+                    && memcmp(ref_pis, pis, (size_t)n * sizeof(float)) == 0) {
+                check = "identique";
+            } else {
+                check = "DIFFÉRENT";
+                mismatches++;
+            }
+
+            printf("%6d  %-9s %16.3f %16.3f %8.1fx  %s\n", n, mx_kernel_name(kernels[k]),
+                   t_dist * 1e3, t_stat * 1e3, t_naive / (t_dist + t_stat), check);
+            fflush(stdout);
+        }
+
+        mx_free(&M);
+        free(pi0);
+        free(pit);
+        free(ref_pit);
+        free(pis);
+        free(ref_pis);
+    }
+
+    mx_kernel_select(MX_KERNEL_AUTO);
+    if (mismatches > 0) {
+        printf("\n=> %d résultat(s) différent(s) du noyau naïf.\n", mismatches);
+        return EXIT_FAILURE;
+    }
+    printf("\n=== FIN BENCH dist_step ===\n");
+    return 0;
+}
@@ -0,0 +1,133 @@
+// Benchmark de remove_transitive_links : bitsets / parcours contre Floyd-Warshall d'origine
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hasse.h"
+#include "graph_gen.h"
+#include "bench_util.h"
+
+/**
+ * @brief  DAG aléatoire de liens entre c classes, 'deg' liens sortants par classe
+ *
+ * Moitié des liens vers une classe proche (chemins longs, beaucoup de liens
+ * transitifs), moitié vers une classe quelconque d'indice supérieur.
+ */
+static void build_links(HasseLinkArray *L, int c, int deg) {
+    hasse_init_links(L);
+    L->capacity = c * deg;
+    L->links = malloc((size_t)L->capacity * sizeof(HasseLink));
+    if (!L->links) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    unsigned seed = 1u;
+    for (int i = 0; i + 1 < c; ++i) {
+        for (int d = 0; d < deg; ++d) {
+            int span = (d % 2 == 0) ? (c - i - 1 < 8 ? c - i - 1 : 8) : c - i - 1;
+            int j = i + 1 + (int)(gen_next_rand(&seed) % (unsigned)span);
+            L->links[L->count].from_class = i;
+            L->links[L->count].to_class = j;
+            L->count++;
+        }
+    }
+}
+
+// Version d'origine : matrice int** et Floyd-Warshall, O(C^3)
+static void floyd_reduction(HasseLinkArray *links, int nb_classes) {
+    int **reach = malloc(nb_classes * sizeof(int *));
+    for (int i = 0; i < nb_classes; i++) reach[i] = calloc(nb_classes, sizeof(int));
+    for (int i = 0; i < links->count; i++) {
+        reach[links->links[i].from_class][links->links[i].to_class] = 1;
+    }
+    for (int k = 0; k < nb_classes; k++)
+        for (int i = 0; i < nb_classes; i++)
+            for (int j = 0; j < nb_classes; j++)
+                if (reach[i][k] && reach[k][j]) reach[i][j] = 1;
+    int write_idx = 0;
+    for (int i = 0; i < links->count; i++) {
+        int from = links->links[i].from_class, to = links->links[i].to_class;
+        int transitive = 0;
+        for (int k = 0; k < nb_classes; k++) {
+            if (k != from && k != to && reach[from][k] && reach[k][to]) {
+                transitive = 1;
+                break;
+            }
+        }
+        if (!transitive) links->links[write_idx++] = links->links[i];
+    }
+    links->count = write_idx;
+    for (int i = 0; i < nb_classes; i++) free(reach[i]);
+    free(reach);
+}
+
+// Mesure une variante (0 : Floyd, 1 : remove_transitive_links, 2 : _lowmem)
+static double time_variant(int variant, int c, int deg, int *kept) {
+    HasseLinkArray L;
+    build_links(&L, c, deg);
+    double start = bench_now_sec();
+    if (variant == 0) floyd_reduction(&L, c);
+    else if (variant == 1) remove_transitive_links(&L, c);
+    else remove_transitive_links_lowmem(&L, c);
+    double t = bench_now_sec() - start;
+    *kept = L.count;
+    hasse_free_links(&L);
+    return t;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--min C] [--max C] [--deg D] [--floyd-max C]\n"
+        "  --min C        Plus petit nombre de classes (def 1000)\n"
+        "  --max C        Plus grand nombre de classes (def 32000), doublé à chaque mesure\n"
+        "  --deg D        Liens sortants par classe (def 4)\n"
+        "  --floyd-max C  Floyd-Warshall d'origine mesuré jusqu'à C classes (def 2000)\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int c_min = 1000, c_max = 32000, deg = 4, floyd_max = 2000;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--min") && i + 1 < argc) {
+            c_min = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--max") && i + 1 < argc) {
+            c_max = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--deg") && i + 1 < argc) {
+            deg = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--floyd-max") && i + 1 < argc) {
+            floyd_max = atoi(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (c_min < 2 || c_max < c_min || deg < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    printf("=== BENCH remove_transitive_links (DAG de classes, %d liens/classe) ===\n", deg);
+    printf("%9s %10s %10s %14s %14s %14s\n", "classes", "liens", "gardés", "Floyd (ms)", "bitsets (ms)", "parcours (ms)");
+
+    int mismatches = 0;
+    for (int c = c_min; c <= c_max; c *= 2) {
+        int kept_f = -1, kept_b = 0, kept_d = 0;
+        double t_f = c <= floyd_max ? time_variant(0, c, deg, &kept_f) : -1.0;
+        double t_b = time_variant(1, c, deg, &kept_b);
+        double t_d = time_variant(2, c, deg, &kept_d);
+        if (kept_b != kept_d || (kept_f >= 0 && kept_f != kept_b)) mismatches++;
+
+        char floyd[32];
+        if (t_f >= 0.0) snprintf(floyd, sizeof(floyd), "%.1f", t_f * 1e3);
+        else snprintf(floyd, sizeof(floyd), "—");
+        printf("%9d %10d %10d %14s %14.1f %14.1f\n", c, (c - 1) * deg, kept_b, floyd, t_b * 1e3, t_d * 1e3);
+        fflush(stdout);
+    }
+
+    if (mismatches > 0) {
+        printf("\n=> %d mesure(s) avec un nombre de liens gardés différent.\n", mismatches);
+        return EXIT_FAILURE;
+    }
+    printf("\n=== FIN BENCH hasse_reduction ===\n");
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Benchmark des noyaux de multiplication dense (GFLOP/s par noyau et par taille)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mx_kernels.h"
+#include "graph_gen.h"
+#include "bench_util.h"
+
+// Matrice n×n pseudo-aléatoire (lignes stochastiques approchées)
+static float *random_matrix(int n, unsigned seed) {
+    float *m = (float *)malloc((size_t)n * (size_t)n * sizeof(float));
+    if (!m) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < (size_t)n * (size_t)n; ++i) {
+        m[i] = (float)(gen_next_rand(&seed) % 1000u) / (1000.0f * (float)n);
+    }
+    return m;
+}
+
+/**
+ * @brief  Mesure un noyau : répète C = A × B jusqu'à min_time secondes
+ *
+ * @return  Durée moyenne d'une multiplication (secondes)
+ */
+static double time_kernel(t_mx_kernel k, const float *A, const float *B, float *C, int n, double min_time) {
+    mx_kernel_select(k);
+    int reps = 0;
+    double start = bench_now_sec();
+    double elapsed = 0.0;
+    do {
+        mx_kernel_mul(A, B, C, n, 0, n);
+        reps++;
+        elapsed = bench_now_sec() - start;
+    } while (elapsed < min_time);
+    return elapsed / reps;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--min N] [--max N] [--naive-max N] [--time S]\n"
+        "  --min N         Plus petite taille (def 64)\n"
+        "  --max N         Plus grande taille (def 4096), tailles doublées\n"
+        "  --naive-max N   Taille max pour le noyau naïf, très lent (def 1024)\n"
+        "  --time S        Durée minimale de mesure par noyau (def 0.2 s)\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int n_min = 64, n_max = 4096, naive_max = 1024;
+    double min_time = 0.2;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--min") && i + 1 < argc) {
+            n_min = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--max") && i + 1 < argc) {
+            n_max = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--naive-max") && i + 1 < argc) {
+            naive_max = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--time") && i + 1 < argc) {
+            min_time = strtod(argv[++i], NULL);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (n_min < 1 || n_max < n_min) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    printf("=== BENCH mx_mul (C = A x B, float) ===\n");
+    printf("noyau automatique : %s\n\n", mx_kernel_name(mx_kernel_active()));
+    printf("%6s  %-9s %12s %10s %9s  %s\n", "n", "noyau", "temps (ms)", "GFLOP/s", "vs naive", "résultat");
+
+    int mismatches = 0;
+    for (int n = n_min; n <= n_max; n *= 2) {
+        float *A = random_matrix(n, 1u);
+        float *B = random_matrix(n, 2u);
+        float *C = (float *)malloc((size_t)n * (size_t)n * sizeof(float));
+        float *ref = (float *)malloc((size_t)n * (size_t)n * sizeof(float));
+        if (!C || !ref) {
+            perror("malloc");
+            return 1;
+        }
+
+        double flops = 2.0 * (double)n * (double)n * (double)n;
+        double t_naive = 0.0;
+        int have_ref = 0;
+        for (int k = MX_KERNEL_NAIVE; k < MX_KERNEL_COUNT; ++k) {
+            if (!mx_kernel_supported((t_mx_kernel)k)) continue;
+            if (k == MX_KERNEL_NAIVE && n > naive_max) continue;
+
+            double t = time_kernel((t_mx_kernel)k, A, B, C, n, min_time);
+
+            // Le premier noyau mesuré sert de référence (identité bit à bit)
+            const char *check = "référence";
+            if (!have_ref) {
+                memcpy(ref, C, (size_t)n * (size_t)n * sizeof(float));
+                have_ref = 1;
+            } else if (memcmp(ref, C, (size_t)n * (size_t)n * sizeof(float)) == 0) {
+                check = "identique";
+            } else {
+                check = "DIFFÉRENT";
+                mismatches++;
+            }
+
+            if (k == MX_KERNEL_NAIVE) t_naive = t;
+            char speedup[16] = "-";
+            if (t_naive > 0.0) snprintf(speedup, sizeof(speedup), "x%.1f", t_naive / t);
+            printf("%6d  %-9s %12.3f %10.2f %9s  %s\n",
+                   n, mx_kernel_name((t_mx_kernel)k), t * 1e3, flops / t * 1e-9, speedup, check);
+            fflush(stdout);
+        }
+        free(A);
+        free(B);
+        free(C);
+        free(ref);
+    }
+
+    mx_kernel_select(MX_KERNEL_AUTO);
+    if (mismatches > 0) {
+        printf("\n=> %d résultat(s) différent(s) de la référence.\n", mismatches);
+        return EXIT_FAILURE;
+    }
+    printf("\n=== FIN BENCH mx_mul ===\n");
+    return 0;
+}
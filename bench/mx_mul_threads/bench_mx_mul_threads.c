@@ -0,0 +1,98 @@
+// Benchmark de passage à l'échelle de mx_mul (1 à 64 threads)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "matrix.h"
+#include "mx_kernels.h"
+#include "graph_gen.h"
+#include "bench_util.h"
+
+// Remplit une matrice n×n de valeurs pseudo-aléatoires
+static void fill_random(t_matrix *M, unsigned seed) {
+    for (int i = 0; i < M->n; ++i) {
+        for (int j = 0; j < M->n; ++j) {
+            M->a[i][j] = (float)(gen_next_rand(&seed) % 1000u) / (1000.0f * (float)M->n);
+        }
+    }
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--n N] [--max-threads T] [--reps R]\n"
+        "  --n N            Taille des matrices (def 2048)\n"
+        "  --max-threads T  Nombre de threads max, doublé à partir de 1 (def 64)\n"
+        "  --reps R         Nombre de multiplications mesurées par point (def 3)\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int n = 2048, max_threads = 64, reps = 3;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--n") && i + 1 < argc) {
+            n = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--max-threads") && i + 1 < argc) {
+            max_threads = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--reps") && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (n < 1 || max_threads < 1 || reps < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    t_matrix A = mx_zeros(n);
+    t_matrix B = mx_zeros(n);
+    t_matrix C = mx_zeros(n);
+    t_matrix ref = mx_zeros(n);
+    fill_random(&A, 1u);
+    fill_random(&B, 2u);
+
+    printf("=== BENCH mx_mul_threads (n=%d, noyau %s) ===\n", n, mx_kernel_name(mx_kernel_active()));
+    printf("%8s %12s %10s %9s %10s  %s\n", "threads", "temps (ms)", "GFLOP/s", "speedup", "efficacité", "résultat");
+
+    double flops = 2.0 * (double)n * (double)n * (double)n;
+    double t1 = 0.0;
+    int mismatches = 0;
+    for (int t = 1; t <= max_threads; t *= 2) {
+        mx_set_threads(t);
+        mx_mul(&A, &B, &C); // échauffement
+        double start = bench_now_sec();
+        for (int r = 0; r < reps; ++r) {
+            mx_mul(&A, &B, &C);
+        }
+        double elapsed = (bench_now_sec() - start) / reps;
+
+        // Le calcul à 1 thread sert de référence (identité bit à bit)
+        const char *check = "référence";
+        if (t == 1) {
+            t1 = elapsed;
+            mx_copy(&C, &ref);
+        } else if (memcmp(ref.a[0], C.a[0], (size_t)n * (size_t)n * sizeof(float)) == 0) {
+            check = "identique";
+        } else {
+            check = "DIFFÉRENT";
+            mismatches++;
+        }
+
+        printf("%8d %12.3f %10.2f %9.2f %9.0f%%  %s\n",
+               t, elapsed * 1e3, flops / elapsed * 1e-9, t1 / elapsed, 100.0 * t1 / elapsed / t, check);
+        fflush(stdout);
+    }
+
+    mx_free(&A);
+    mx_free(&B);
+    mx_free(&C);
+    mx_free(&ref);
+
+    if (mismatches > 0) {
+        printf("\n=> %d résultat(s) différent(s) du calcul à 1 thread.\n", mismatches);
+        return EXIT_FAILURE;
+    }
+    printf("\n=== FIN BENCH mx_mul_threads ===\n");
+    return 0;
+}
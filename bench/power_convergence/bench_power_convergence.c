@@ -0,0 +1,96 @@
+// Benchmark de la recherche de convergence diff(M^n, M^(n+1)) < eps : linéaire contre carrés successifs
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "matrix.h"
+#include "bench_util.h"
+
+/**
+ * @brief  Marche paresseuse sur un anneau de n états
+ *
+ * Reste sur place avec la probabilité stay, sinon passe à un voisin. Le
+ * temps de mélange croît en n² / (1 - stay) : des milliers d'étapes dès
+ * quelques dizaines d'états.
+ */
+static t_matrix lazy_ring(int n, float stay) {
+    t_matrix M = mx_zeros(n);
+    for (int i = 0; i < n; ++i) {
+        M.a[i][i] = stay;
+        M.a[i][(i + 1) % n] += (1.0f - stay) / 2.0f;
+        M.a[i][(i + n - 1) % n] += (1.0f - stay) / 2.0f;
+    }
+    return M;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--min N] [--max N] [--stay P] [--eps E] [--max-iter K] [--linear-max N]\n"
+        "  --min N         Plus petit anneau (def 16)\n"
+        "  --max N         Plus grand anneau (def 256), tailles doublées\n"
+        "  --stay P        Probabilité de rester sur place (def 0.9)\n"
+        "  --eps E         Tolérance (def 1e-3)\n"
+        "  --max-iter K    Itérations max (def 1000000)\n"
+        "  --linear-max N  Taille max pour la recherche linéaire, très lente (def 128)\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int n_min = 16, n_max = 256, max_iter = 1000000, linear_max = 128;
+    float stay = 0.9f, eps = 1e-3f;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--min") && i + 1 < argc) {
+            n_min = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--max") && i + 1 < argc) {
+            n_max = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--stay") && i + 1 < argc) {
+            stay = strtof(argv[++i], NULL);
+        } else if (!strcmp(argv[i], "--eps") && i + 1 < argc) {
+            eps = strtof(argv[++i], NULL);
+        } else if (!strcmp(argv[i], "--max-iter") && i + 1 < argc) {
+            max_iter = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--linear-max") && i + 1 < argc) {
+            linear_max = atoi(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (n_min < 3 || n_max < n_min || max_iter < 1 || stay < 0.0f || stay >= 1.0f) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    printf("=== BENCH power_convergence (anneau paresseux, stay=%.2f, eps=%.0e) ===\n", (double)stay,
+           (double)eps);
+    printf("%6s  %10s %12s  %10s %12s  %8s\n", "n", "n lin.", "linéaire (s)", "n carrés", "carrés (s)", "gain");
+
+    for (int n = n_min; n <= n_max; n *= 2) {
+        t_matrix M = lazy_ring(n, stay);
+        t_matrix out = mx_zeros(0);
+
+        int n_sq = 0;
+        double start = bench_now_sec();
+        int rc_sq = mx_power_until_diff_squaring(&M, eps, max_iter, &out, &n_sq);
+        double t_sq = bench_now_sec() - start;
+
+        if (n <= linear_max) {
+            int n_lin = 0;
+            start = bench_now_sec();
+            int rc_lin = mx_power_until_diff(&M, eps, max_iter, &out, &n_lin);
+            double t_lin = bench_now_sec() - start;
+            printf("%6d  %9d%s %12.3f  %9d%s %12.4f  %7.0fx\n", n, n_lin, rc_lin == 1 ? " " : "*", t_lin, n_sq,
+                   rc_sq == 1 ? " " : "*", t_sq, t_lin / t_sq);
+        } else {
+            printf("%6d  %10s %12s  %9d%s %12.4f  %8s\n", n, "-", "-", n_sq, rc_sq == 1 ? " " : "*", t_sq, "-");
+        }
+        fflush(stdout);
+
+        mx_free(&out);
+        mx_free(&M);
+    }
+
+    printf("(* : non atteint en --max-iter itérations)\n");
+    printf("\n=== FIN BENCH power_convergence ===\n");
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Benchmark d'une itération de puissance (étape + résidu L1) : stationary_distribution(_sp), mx_diff_abs1
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "matrix.h"
+#include "graph_gen.h"
+#include "bench_util.h"
+
+/**
+ * @brief  Chaîne creuse de n états, deg arcs par état (dont i -> i+1)
+ *
+ * Les autres successeurs sont tirés dans une fenêtre de ±window états :
+ * accès mémoire proches, comme un graphe numéroté par parcours. Construite
+ * directement au format CSR (graph_add_edge est en O(n) par arc).
+ */
+static t_spmatrix random_chain(int n, int deg, int window) {
+    t_spmatrix S;
+    S.n = n;
+    S.nnz = (int64_t)n * deg;
+    S.row_ptr = (int64_t *)malloc(((size_t)n + 1) * sizeof(int64_t));
+    S.col = (int *)malloc((size_t)S.nnz * sizeof(int));
+    S.val = (float *)malloc((size_t)S.nnz * sizeof(float));
+    if (!S.row_ptr || !S.col || !S.val) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    unsigned seed = 11u;
+    int64_t k = 0;
+    for (int i = 0; i < n; ++i) {
+        S.row_ptr[i] = k;
+        S.col[k] = (i + 1) % n;
+        S.val[k++] = 1.0f / (float)deg;
+        for (int d = 1; d < deg; ++d) {
+            int w = i + (int)(gen_next_rand(&seed) % (unsigned)(2 * window + 1)) - window;
+            S.col[k] = (w % n + n) % n;
+            S.val[k++] = 1.0f / (float)deg;
+        }
+    }
+    S.row_ptr[n] = k;
+    return S;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--n-sparse N] [--n-dense N] [--deg D] [--steps T]\n"
+        "  --n-sparse N  Taille de la chaîne creuse (def 4000000)\n"
+        "  --n-dense N   Taille de la matrice dense (def 4096)\n"
+        "  --deg D       Arcs par état de la chaîne creuse (def 4)\n"
+        "  --steps T     Itérations mesurées (def 50)\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int n_sparse = 4000000, n_dense = 4096, deg = 4, steps = 50;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--n-sparse") && i + 1 < argc) {
+            n_sparse = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--n-dense") && i + 1 < argc) {
+            n_dense = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--deg") && i + 1 < argc) {
+            deg = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--steps") && i + 1 < argc) {
+            steps = atoi(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (n_sparse < 2 || n_dense < 2 || deg < 1 || steps < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    printf("=== BENCH power_step (eps = 0 : exactement %d itérations) ===\n", steps);
+
+    // Chaîne creuse : stationary_distribution_sp
+    t_spmatrix S = random_chain(n_sparse, deg, 64);
+    float *pi = (float *)malloc((size_t)n_sparse * sizeof(float));
+    if (!pi) {
+        perror("malloc");
+        return 1;
+    }
+    double start = bench_now_sec();
+    stationary_distribution_sp(&S, 0.0f, steps, pi);
+    double t_sp = bench_now_sec() - start;
+    printf("  creuse  n=%-8d nnz=%-9lld %8.3f ms/itération\n", n_sparse, (long long)S.nnz, t_sp * 1e3 / steps);
+    free(pi);
+    spmx_free(&S);
+
+    // Matrice dense : stationary_distribution, puis mx_diff_abs1
+    t_matrix M = mx_zeros(n_dense);
+    unsigned seed = 5u;
+    for (int i = 0; i < n_dense; ++i) {
+        float sum = 0.0f;
+        for (int j = 0; j < n_dense; ++j) {
+            M.a[i][j] = 1.0f + (float)(gen_next_rand(&seed) % 100u);
+            sum += M.a[i][j];
+        }
+        for (int j = 0; j < n_dense; ++j) M.a[i][j] /= sum;
+    }
+    pi = (float *)malloc((size_t)n_dense * sizeof(float));
+    if (!pi) {
+        perror("malloc");
+        return 1;
+    }
+    start = bench_now_sec();
+    stationary_distribution(&M, 0.0f, steps, pi);
+    double t_dense = bench_now_sec() - start;
+    printf("  dense   n=%-8d               %8.3f ms/itération\n", n_dense, t_dense * 1e3 / steps);
+
+    t_matrix N = mx_zeros(n_dense);
+    mx_copy(&M, &N);
+    N.a[0][0] += 0.5f;
+    float d = 0.0f;
+    start = bench_now_sec();
+    for (int k = 0; k < steps; ++k) d += mx_diff_abs1(&M, &N);
+    double t_diff = bench_now_sec() - start;
+    printf("  mx_diff_abs1 n=%-8d          %8.3f ms/appel (somme %.3f)\n", n_dense, t_diff * 1e3 / steps,
+           (double)d / steps);
+
+    free(pi);
+    mx_free(&M);
+    mx_free(&N);
+    printf("\n=== FIN BENCH power_step ===\n");
+    return 0;
+}
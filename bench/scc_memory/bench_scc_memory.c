@@ -0,0 +1,136 @@
+// Benchmark mémoire des CFC : pic RSS de tarjan_partition contre scc_partition_pearce
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "graph.h"
+#include "scc.h"
+#include "tarjan.h"
+#include "scc_pearce.h"
+#include "utils.h"
+#include "graph_gen.h"
+#include "bench_util.h"
+
+// Mesure renvoyée par le processus fils
+typedef struct {
+    double seconds;
+    int classes;
+    long rss_graph_kb;  // pic RSS une fois le graphe construit
+    long rss_peak_kb;   // pic RSS après le calcul des CFC
+} t_measure;
+
+/**
+ * @brief  Mesure un algorithme de CFC dans un processus fils
+ *
+ * Le pic RSS d'un processus ne redescend jamais : chaque mesure se fait
+ * dans un fils neuf, qui construit le graphe, relève le pic, lance
+ * l'algorithme puis relève le pic à nouveau. L'écart est la mémoire de
+ * travail de l'algorithme (partition de sortie comprise).
+ *
+ * @return  0 si la mesure a abouti, -1 sinon
+ */
+static int measure(int kind, int n, int deg, int pearce, t_measure *m) {
+    int fd[2];
+    if (pipe(fd) != 0) return -1;
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fd[0]);
+        close(fd[1]);
+        return -1;
+    }
+    if (pid == 0) {
+        close(fd[0]);
+        AdjList g;
+        if (kind == 0) gen_birth_death(&g, n);
+        else gen_random(&g, n, deg, 1u);
+
+        t_measure r;
+        r.rss_graph_kb = peak_rss_kb();
+        Partition P;
+        scc_init_partition(&P);
+        double start = bench_now_sec();
+        if (pearce) scc_partition_pearce(&g, &P);
+        else tarjan_partition(&g, &P);
+        r.seconds = bench_now_sec() - start;
+        r.rss_peak_kb = peak_rss_kb();
+        r.classes = P.count;
+
+        ssize_t w = write(fd[1], &r, sizeof(r));
+        close(fd[1]);
+        _exit(w == (ssize_t)sizeof(r) ? 0 : 1);
+    }
+
+    close(fd[1]);
+    ssize_t got = read(fd[0], m, sizeof(*m));
+    close(fd[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return (got == (ssize_t)sizeof(*m) && WIFEXITED(status) && WEXITSTATUS(status) == 0) ? 0 : -1;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--min N] [--max N] [--deg D]\n"
+        "  --min N    Plus petite taille (def 1000000)\n"
+        "  --max N    Plus grande taille (def 8000000), tailles doublées\n"
+        "  --deg D    Degré sortant des graphes aléatoires (def 4)\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int n_min = 1000000, n_max = 8000000, deg = 4;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--min") && i + 1 < argc) {
+            n_min = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--max") && i + 1 < argc) {
+            n_max = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--deg") && i + 1 < argc) {
+            deg = atoi(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (n_min < 1 || n_max < n_min || deg < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (peak_rss_kb() < 0) {
+        fprintf(stderr, "[ERR] Pic RSS indisponible sur cette plateforme\n");
+        return 1;
+    }
+
+    printf("=== BENCH mémoire des CFC (tarjan vs pearce) ===\n");
+    printf("%-10s %9s %10s %12s %14s %14s %10s %10s\n", "graphe", "n", "classes", "graphe (Mo)",
+           "+tarjan (Mo)", "+pearce (Mo)", "tarjan ms", "pearce ms");
+
+    int mismatches = 0;
+    for (int kind = 0; kind < 2; ++kind) {
+        for (int n = n_min; n <= n_max; n *= 2) {
+            t_measure mt, mp;
+            if (measure(kind, n, deg, 0, &mt) != 0 || measure(kind, n, deg, 1, &mp) != 0) {
+                fprintf(stderr, "[ERR] Mesure impossible (n=%d)\n", n);
+                return EXIT_FAILURE;
+            }
+            if (mt.classes != mp.classes) mismatches++;
+            printf("%-10s %9d %10d %12.1f %14.1f %14.1f %10.1f %10.1f\n",
+                   kind == 0 ? "chaîne" : "aléatoire", n, mp.classes,
+                   (double)mt.rss_graph_kb / 1024.0,
+                   (double)(mt.rss_peak_kb - mt.rss_graph_kb) / 1024.0,
+                   (double)(mp.rss_peak_kb - mp.rss_graph_kb) / 1024.0,
+                   mt.seconds * 1e3, mp.seconds * 1e3);
+            fflush(stdout);
+        }
+    }
+
+    if (mismatches > 0) {
+        printf("\n=> %d mesure(s) avec un nombre de classes différent.\n", mismatches);
+        return EXIT_FAILURE;
+    }
+    printf("\n=== FIN BENCH scc_memory ===\n");
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Benchmark de scc_partition_parallel : passage à l'échelle et comparaison à Tarjan
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph.h"
+#include "scc.h"
+#include "tarjan.h"
+#include "scc_parallel.h"
+#include "graph_gen.h"
+#include "bench_util.h"
+
+// Meilleur temps sur 'reps' essais ; nthreads = 0 : Tarjan séquentiel
+static double time_scc(const AdjList *g, int nthreads, int reps, int *classes) {
+    double best = -1.0;
+    for (int r = 0; r < reps; ++r) {
+        Partition P;
+        scc_init_partition(&P);
+        double start = bench_now_sec();
+        if (nthreads == 0) tarjan_partition(g, &P);
+        else scc_partition_parallel(g, &P, nthreads);
+        double t = bench_now_sec() - start;
+        if (best < 0.0 || t < best) best = t;
+        *classes = P.count;
+        scc_free_partition(&P);
+    }
+    return best;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--n N] [--deg D] [--max-threads T] [--reps R]\n"
+        "  --n N            Nombre de sommets (def 4000000)\n"
+        "  --deg D          Degré sortant des graphes aléatoires (def 4)\n"
+        "  --max-threads T  Nombre de threads max, doublé à partir de 1 (def 64)\n"
+        "  --reps R         Nombre d'essais par point, meilleur temps retenu (def 3)\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int n = 4000000, deg = 4, max_threads = 64, reps = 3;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--n") && i + 1 < argc) {
+            n = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--deg") && i + 1 < argc) {
+            deg = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--max-threads") && i + 1 < argc) {
+            max_threads = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--reps") && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (n < 2 || deg < 1 || max_threads < 1 || reps < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    const char *names[] = {"aléatoire", "chaîne", "DAG"};
+    printf("=== BENCH scc_partition_parallel (n=%d) ===\n", n);
+    printf("%-10s %8s %10s %12s %9s %10s\n", "graphe", "threads", "classes", "temps (ms)", "speedup", "vs Tarjan");
+
+    int mismatches = 0;
+    for (int kind = 0; kind < 3; ++kind) {
+        AdjList g;
+        if (kind == 0) gen_random(&g, n, deg, 1u);
+        else if (kind == 1) gen_birth_death(&g, n);
+        else gen_dag_shortcuts(&g, n, deg, 7u);
+
+        int c_ref = 0;
+        double t_tarjan = time_scc(&g, 0, reps, &c_ref);
+        printf("%-10s %8s %10d %12.2f %9s %10s\n", names[kind], "Tarjan", c_ref, t_tarjan * 1e3, "", "1.00x");
+
+        double t_one = 0.0;
+        for (int t = 1; t <= max_threads; t *= 2) {
+            int c = 0;
+            double dt = time_scc(&g, t, reps, &c);
+            if (t == 1) t_one = dt;
+            if (c != c_ref) mismatches++;
+            printf("%-10s %8d %10d %12.2f %8.2fx %9.2fx\n", names[kind], t, c, dt * 1e3,
+                   t_one / dt, t_tarjan / dt);
+            fflush(stdout);
+        }
+        graph_free(&g);
+    }
+
+    if (mismatches > 0) {
+        printf("\n=> %d mesure(s) avec un nombre de classes différent de Tarjan.\n", mismatches);
+        return EXIT_FAILURE;
+    }
+    printf("\n=== FIN BENCH scc_parallel ===\n");
+    return 0;
+}
@@ -0,0 +1,275 @@
+// Benchmark des solveurs de distribution stationnaire (power, gth, gs, sor, bicgstab)
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+
+#include "io.h"
+#include "tarjan.h"
+#include "matrix.h"
+#include "stationary.h"
+#include "graph_gen.h"
+#include "bench_util.h"
+
+#ifndef DATA_DIR
+#error DATA_DIR doit être défini (par CMakeLists)
+#endif
+
+static const t_stat_solver SOLVERS[] = {STAT_POWER, STAT_GTH, STAT_GS, STAT_SOR, STAT_BICGSTAB};
+#define NSOLVERS ((int)(sizeof(SOLVERS) / sizeof(SOLVERS[0])))
+
+/**
+ * @brief  Chaîne synthétique au format CSR
+ *
+ * Chaque état i a un arc vers succ(i) (garantit l'irréductibilité), deg arcs
+ * aléatoires vers des états de [lo(i), lo(i) + span) et, si leak > 0, un arc
+ * vers l'état i + span (mod n), qui couple les blocs en anneau. La fuite
+ * vaut leak, 2·leak ou 3·leak selon le bloc : la masse stationnaire des
+ * blocs est inégale et la loi uniforme en est loin.
+ *
+ * @param n       Nombre d'états
+ * @param deg     Arcs aléatoires par état
+ * @param span    Taille des blocs (n : un seul bloc)
+ * @param leak    Probabilité de sortie du bloc (0 : aucune)
+ * @param parity  1 : classe de période 2 (n multiple de 3), sous-classes
+ *                A = {i : i mod 3 = 0} et B = les autres ; tous les arcs
+ *                vont de A vers B ou de B vers A. |A| = n/3 : partant de la
+ *                loi uniforme, l'itération de la puissance oscille.
+ */
+static t_spmatrix synthetic_chain(int n, int deg, int span, double leak, int parity) {
+    t_spmatrix S;
+    S.n = n;
+    S.row_ptr = (int64_t *)malloc(((size_t)n + 1) * sizeof(int64_t));
+    S.col = (int *)malloc((size_t)n * (deg + 2) * sizeof(int));
+    S.val = (float *)malloc((size_t)n * (deg + 2) * sizeof(float));
+    if (!S.row_ptr || !S.col || !S.val) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned seed = 11u;
+    int64_t pos = 0;
+    S.row_ptr[0] = 0;
+    for (int i = 0; i < n; ++i) {
+        int lo = (i / span) * span;
+        int len = (lo + span <= n) ? span : n - lo;
+        int64_t start = pos;
+        double w[64];
+        double sum = 0.0;
+
+        // cycle dans le bloc ; en mode période 2 : A_k -> B_k, B_k -> A_{k+1}
+        if (parity) {
+            S.col[pos] = (i % 3 == 0) ? i + 1 + (int)(gen_next_rand(&seed) & 1u) : (i / 3 + 1) * 3 % n;
+        } else {
+            S.col[pos] = (i + 1 - lo) % len + lo;
+        }
+        w[0] = 1.0;
+        sum += 1.0;
+        pos++;
+        for (int d = 0; d < deg && d < 60; ++d) {
+            int j = lo + (int)(gen_next_rand(&seed) % (unsigned)len);
+            if (parity) {
+                if (i % 3 == 0 && j % 3 == 0) j = (j + 1) % n;        // A -> B
+                if (i % 3 != 0) j = (j / 3) * 3;                      // B -> A
+            }
+            int dup = 0;
+            for (int64_t k = start; k < pos; ++k) dup |= (S.col[k] == j);
+            if (dup) continue;
+            S.col[pos] = j;
+            w[pos - start] = 0.1 + (double)(gen_next_rand(&seed) % 100u) / 50.0;
+            sum += w[pos - start];
+            pos++;
+        }
+        int64_t m = pos - start;
+        double out = leak * (double)(1 + (i / span) % 3);
+        for (int64_t k = 0; k < m; ++k) {
+            S.val[start + k] = (float)((1.0 - out) * w[k] / sum);
+        }
+        if (out > 0.0) {
+            S.col[pos] = (i + span) % n;
+            S.val[pos] = (float)out;
+            pos++;
+        }
+        S.row_ptr[i + 1] = pos;
+    }
+    S.nnz = pos;
+    return S;
+}
+
+/**
+ * @brief  Mesure chaque solveur sur une matrice et affiche une ligne par solveur
+ *
+ * @return  Nombre de solveurs (hors power) n'ayant pas convergé
+ */
+static int run_solvers(const char *label, const t_spmatrix *S, float eps, int max_iter, int gth_max) {
+    float *pi = (float *)malloc((size_t)S->n * sizeof(float));
+    if (!pi) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    int failures = 0;
+    for (int s = 0; s < NSOLVERS; ++s) {
+        if (SOLVERS[s] == STAT_GTH && S->n > gth_max) {
+            printf("  %-28s %-9s %10s\n", label, stationary_solver_name(SOLVERS[s]), "ignoré");
+            continue;
+        }
+        t_solve_info info;
+        double t0 = bench_now_sec();
+        int conv = stationary_solve(S, SOLVERS[s], eps, max_iter, 0.8, pi, &info);
+        double t1 = bench_now_sec();
+        printf("  %-28s %-9s %10.2f %9d %11.2e  %s\n", label, stationary_solver_name(SOLVERS[s]),
+               (t1 - t0) * 1e3, info.iters, info.residual, conv ? "oui" : "non");
+        if (!conv && SOLVERS[s] != STAT_POWER) failures++;
+    }
+    free(pi);
+    return failures;
+}
+
+static int ends_with_txt(const char *name) {
+    size_t n = strlen(name);
+    return n >= 4 && strcmp(name + (n - 4), ".txt") == 0;
+}
+
+// 1 si chaque ligne de S somme à 1 (à 1e-3 près) ; les arcs en double du
+// fichier sont écrasés par spmx_from_adjlist et cassent cette propriété
+static int is_stochastic(const t_spmatrix *S) {
+    for (int i = 0; i < S->n; ++i) {
+        double s = 0.0;
+        for (int64_t k = S->row_ptr[i]; k < S->row_ptr[i + 1]; ++k) s += S->val[k];
+        if (s < 0.999 || s > 1.001) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief  Solveurs sur chaque classe persistante (taille >= 2) des fichiers texte de data/
+ */
+static int bench_data(float eps, int max_iter, int gth_max) {
+    DIR *dir = opendir(DATA_DIR);
+    if (!dir) {
+        perror("opendir(DATA_DIR)");
+        return 1;
+    }
+    int failures = 0;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL) {
+        if (ent->d_name[0] == '.' || !ends_with_txt(ent->d_name)) continue;
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", DATA_DIR, ent->d_name);
+
+        AdjList g;
+        read_graph_from_file(path, &g);
+        if (g.size <= 0) {
+            graph_free(&g);
+            continue;
+        }
+        t_spmatrix S = spmx_from_adjlist(&g);
+        if (!is_stochastic(&S)) {
+            spmx_free(&S);
+            graph_free(&g);
+            continue;
+        }
+        Partition P;
+        scc_init_partition(&P);
+        tarjan_partition(&g, &P);
+
+        for (int k = 0; k < P.count; ++k) {
+            SccClass c = scc_class(&P, k);
+            int persistent = 1;
+            for (int i = 0; i < c.count && persistent; ++i) {
+                int v = c.verts[i];
+                for (int64_t e = g.offsets[v - 1]; e < g.offsets[v]; ++e) {
+                    if (P.class_of[g.dests[e]] != k) { persistent = 0; break; }
+                }
+            }
+            if (!persistent || c.count < 2) continue;
+
+            t_spmatrix sub = spmx_sub(&S, P, k);
+            char label[64];
+            snprintf(label, sizeof(label), "%.20s C%d", ent->d_name, k + 1);
+            failures += run_solvers(label, &sub, eps, max_iter, gth_max);
+            spmx_free(&sub);
+        }
+
+        spmx_free(&S);
+        scc_free_partition(&P);
+        graph_free(&g);
+    }
+    closedir(dir);
+    return failures;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--n N] [--block B] [--eps E] [--max-iter K] [--gth-max N] [--no-data]\n"
+        "  --n N         Taille des chaînes synthétiques (def 100000)\n"
+        "  --block B     Taille des blocs de la chaîne presque décomposable (def n/10)\n"
+        "  --eps E       Tolérance (def 1e-7)\n"
+        "  --max-iter K  Itérations max par solveur (def 10000)\n"
+        "  --gth-max N   GTH ignoré au-delà de N états (def 2000)\n"
+        "  --no-data     Ne mesure que les chaînes synthétiques\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int n = 100000, block = 0, block_set = 0, max_iter = 10000, gth_max = 2000, with_data = 1;
+    float eps = 1e-7f;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--n") && i + 1 < argc) {
+            n = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--block") && i + 1 < argc) {
+            block = atoi(argv[++i]);
+            block_set = 1;
+        } else if (!strcmp(argv[i], "--eps") && i + 1 < argc) {
+            eps = strtof(argv[++i], NULL);
+        } else if (!strcmp(argv[i], "--max-iter") && i + 1 < argc) {
+            max_iter = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--gth-max") && i + 1 < argc) {
+            gth_max = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--no-data")) {
+            with_data = 0;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (n < 6 || (block_set && (block < 2 || block > n)) || max_iter < 1 || eps <= 0.0f) {
+        usage(argv[0]);
+        return 1;
+    }
+    n -= n % 3; // multiple de 3 pour la chaîne périodique
+    if (block_set == 0) block = n / 10;
+
+    printf("=== BENCH solveurs stationnaires (eps = %.1e, %d itérations max) ===\n", (double)eps, max_iter);
+    printf("  %-28s %-9s %10s %9s %11s  %s\n", "matrice", "solveur", "temps (ms)", "itér.", "résidu", "convergé");
+
+    int failures = 0;
+    if (with_data) failures += bench_data(eps, max_iter, gth_max);
+
+    char label[64];
+    t_spmatrix R = synthetic_chain(n, 4, n, 0.0, 0);
+    snprintf(label, sizeof(label), "aléatoire n=%d", n);
+    failures += run_solvers(label, &R, eps, max_iter, gth_max);
+    spmx_free(&R);
+
+    t_spmatrix D = synthetic_chain(n, 4, block, 1e-3, 0);
+    snprintf(label, sizeof(label), "presque décomp. n=%d", n);
+    failures += run_solvers(label, &D, eps, max_iter, gth_max);
+    spmx_free(&D);
+
+    t_spmatrix C = synthetic_chain(n, 4, n, 0.0, 1);
+    snprintf(label, sizeof(label), "période 2 n=%d", n);
+    failures += run_solvers(label, &C, eps, max_iter, gth_max);
+    spmx_free(&C);
+
+    t_spmatrix G = synthetic_chain(gth_max, 4, gth_max / 8, 1e-3, 0);
+    snprintf(label, sizeof(label), "presque décomp. n=%d", gth_max);
+    failures += run_solvers(label, &G, eps, max_iter, gth_max);
+    spmx_free(&G);
+
+    if (failures > 0) {
+        printf("[WARN] %d mesure(s) sans convergence (hors power)\n", failures);
+    }
+    return 0;
+}
@@ -0,0 +1,125 @@
+// Benchmark de tarjan_partition : itératif (pile explicite) contre récursif
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "graph.h"
+#include "scc.h"
+#include "tarjan.h"
+#include "graph_gen.h"
+#include "bench_util.h"
+
+// Appel de la variante récursive dans un thread à pile agrandie
+typedef struct {
+    const AdjList *g;
+    Partition *out;
+} t_job;
+
+static void *run_recursive(void *arg) {
+    t_job *job = (t_job *)arg;
+    tarjan_partition_recursive(job->g, job->out);
+    return NULL;
+}
+
+/**
+ * @brief  Mesure une variante de Tarjan (meilleur temps sur 'reps' essais)
+ *
+ * La variante récursive tourne dans un thread dont la pile est dimensionnée
+ * pour la profondeur du graphe (la pile par défaut déborderait).
+ *
+ * @return  Temps en secondes, < 0 si le thread n'a pas pu être créé
+ */
+static double time_variant(const AdjList *g, int recursive, int reps, int *classes) {
+    double best = -1.0;
+    for (int r = 0; r < reps; ++r) {
+        Partition P;
+        scc_init_partition(&P);
+        double start = bench_now_sec();
+        if (recursive) {
+            pthread_attr_t attr;
+            pthread_attr_init(&attr);
+            pthread_attr_setstacksize(&attr, (size_t)g->size * 256 + ((size_t)1 << 20));
+            pthread_t tid;
+            t_job job = {g, &P};
+            int rc = pthread_create(&tid, &attr, run_recursive, &job);
+            pthread_attr_destroy(&attr);
+            if (rc != 0) return -1.0;
+            pthread_join(tid, NULL);
+        } else {
+            tarjan_partition(g, &P);
+        }
+        double t = bench_now_sec() - start;
+        if (best < 0.0 || t < best) best = t;
+        *classes = P.count;
+        scc_free_partition(&P);
+    }
+    return best;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+        "Usage: %s [--min N] [--max N] [--deg D] [--reps R]\n"
+        "  --min N    Plus petite taille (def 100000)\n"
+        "  --max N    Plus grande taille (def 3200000), tailles doublées\n"
+        "  --deg D    Degré sortant des graphes aléatoires (def 4)\n"
+        "  --reps R   Nombre d'essais par mesure, meilleur temps retenu (def 3)\n",
+        prog);
+}
+
+int main(int argc, char **argv) {
+    int n_min = 100000, n_max = 3200000, deg = 4, reps = 3;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--min") && i + 1 < argc) {
+            n_min = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--max") && i + 1 < argc) {
+            n_max = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--deg") && i + 1 < argc) {
+            deg = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--reps") && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (n_min < 1 || n_max < n_min || deg < 1 || reps < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    printf("=== BENCH tarjan_partition (itératif vs récursif) ===\n");
+    printf("%-10s %9s %10s %16s %16s %8s\n", "graphe", "n", "classes", "récursif (ms)", "itératif (ms)", "gain");
+
+    int mismatches = 0;
+    for (int kind = 0; kind < 2; ++kind) {
+        for (int n = n_min; n <= n_max; n *= 2) {
+            AdjList g;
+            if (kind == 0) gen_birth_death(&g, n);
+            else gen_random(&g, n, deg, 1u);
+
+            int c_rec = 0, c_it = 0;
+            double t_rec = time_variant(&g, 1, reps, &c_rec);
+            double t_it = time_variant(&g, 0, reps, &c_it);
+            if (t_rec >= 0.0 && c_rec != c_it) mismatches++;
+
+            if (t_rec >= 0.0) {
+                printf("%-10s %9d %10d %16.2f %16.2f %7.2fx\n", kind == 0 ? "chaîne" : "aléatoire",
+                       n, c_it, t_rec * 1e3, t_it * 1e3, t_rec / t_it);
+            } else {
+                printf("%-10s %9d %10d %16s %16.2f %8s\n", kind == 0 ? "chaîne" : "aléatoire",
+                       n, c_it, "—", t_it * 1e3, "—");
+            }
+            fflush(stdout);
+            graph_free(&g);
+        }
+    }
+
+    if (mismatches > 0) {
+        printf("\n=> %d mesure(s) avec un nombre de classes différent.\n", mismatches);
+        return EXIT_FAILURE;
+    }
+    printf("\n=== FIN BENCH tarjan ===\n");
+    return 0;
+}
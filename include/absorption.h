@@ -0,0 +1,40 @@
+#ifndef ABSORPTION_H
+#define ABSORPTION_H
+#include "graph.h"
+#include "scc.h"
+#include "linsolve.h"
+
+// Tolérance relative et balayages max de Gauss-Seidel par classe transitoire
+#define ABSORB_TOL       1e-9
+#define ABSORB_MAX_ITER  10000
+
+// Absorption depuis les états transitoires : probabilité de finir dans
+// chaque classe persistante et nombre moyen de pas avant d'y entrer.
+// Les probabilités sont rangées en CSR : la ligne r n'a qu'une entrée par
+// cible atteignable depuis sa classe, [row_ptr[r], row_ptr[r+1]) dans
+// tgt/prob, cibles croissantes.
+typedef struct {
+    int      n_states;      // nombre d'états transitoires
+    int      n_targets;     // nombre de classes persistantes (cibles)
+    int     *target_class;  // [n_targets] indice de classe de chaque cible
+    int     *row_of;        // [size+1] ligne de l'état v, -1 s'il est persistant
+    int64_t *row_ptr;       // [n_states+1] début des entrées de chaque ligne
+    int64_t  nnz;           // nombre d'entrées
+    int     *tgt;           // [nnz] indice de cible de chaque entrée
+    double  *prob;          // [nnz] probabilité d'absorption dans cette cible
+    double  *steps;         // [n_states] nombre moyen de pas avant absorption
+    t_solve_info *class_info;  // [nb_classes] bilan de résolution (classes transitoires)
+} t_absorption;
+
+// Résout (I - Q) [B | t] = [R | 1] classe transitoire par classe transitoire,
+// des classes puits vers les sources, sans former N = (I - Q)^-1.
+// is_persistent : [p->count] (markov_class_types ou t_class_props).
+// Retour : 1 si toutes les classes ont convergé, 0 sinon, -1 si invalide.
+int  absorption_compute(const AdjList *g, const Partition *p, const int *is_persistent,
+                        double tol, int max_iter, t_absorption *out);
+void absorption_free(t_absorption *a);
+
+// Probabilité de finir dans la cible t depuis l'état v (0 si non atteignable)
+double absorption_prob(const t_absorption *a, int v, int t);
+
+#endif
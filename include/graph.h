@@ -1,16 +1,26 @@
 #ifndef GRAPH_H
 #define GRAPH_H
-#include "list.h"
+#include <stddef.h>
+#include <stdint.h>
 
+// Graphe en format CSR (compressed sparse row) : les arêtes sortantes du
+// sommet i+1 occupent les indices [offsets[i], offsets[i+1]) de dests/probas.
 typedef struct {
-    int  size;     // nb de sommets
-    List *array;   // tableau de listes: array[i] = sorties du sommet i+1
+    int      size;     // nb de sommets
+    int64_t  nnz;      // nb d'arêtes
+    int64_t *offsets;  // tableau de taille size+1 (offsets[0] = 0, offsets[size] = nnz)
+    int     *dests;    // sommets d'arrivée (1..size), taille nnz
+    float   *probas;   // probabilités de transition, taille nnz
+    int64_t  cap;      // capacité allouée de dests/probas
+    void    *map;      // projection mémoire portant les tableaux (.mgb), NULL sinon
+    size_t   map_len;  // taille de la projection
 } AdjList;
 
 // API graphe
 void     graph_init(AdjList *g, int n);
 void     graph_free(AdjList *g);
 void     graph_add_edge(AdjList *g, int from, int to, float proba);
+void     graph_reserve(AdjList *g, int64_t nnz);
 void     graph_print(const AdjList *g);
 
 #endif
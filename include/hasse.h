@@ -4,21 +4,48 @@
 #include "scc.h"
 
 typedef struct {
-    int from_class;
-    int to_class;
+    int     from_class;
+    int     to_class;
+    double  proba;      // somme des probabilités des arcs from -> to
+    int64_t edges;      // nombre d'arcs du graphe entre les deux classes
+    double  flow;       // somme des poids(v) * p(v -> w), si poids fournis
 } HasseLink;
 
 typedef struct {
     HasseLink *links;
     int        count;
     int        capacity;
+    int        weighted;  // 1 si proba/edges sont renseignés
+    int        has_flow;  // 1 si flow est renseigné
 } HasseLinkArray;
 
+// Graphe de condensation (classes -> classes) au format CSR, sans doublon :
+// les successeurs de la classe c sont succ[offsets[c] .. offsets[c+1]-1]
+typedef struct {
+    int      n;        // nombre de classes
+    int64_t *offsets;  // [n+1]
+    int     *succ;     // classes d'arrivée (0-basées)
+    int64_t  nnz;      // nombre de liens
+    int     *topo;     // [n] classes en ordre topologique (sources d'abord)
+    double  *proba;    // [nnz] somme des probabilités des arcs de chaque lien
+    int64_t *edges;    // [nnz] nombre d'arcs de chaque lien
+    double  *flow;     // [nnz] flux pondéré par les poids des sommets (NULL sans poids)
+} t_condensation;
+
 void build_vertex_to_class_map(Partition *p, int n_vertices, int *class_of_vertex);
 
 void build_class_links(const AdjList *g, const Partition *p, HasseLinkArray *out_links);
+// vertex_weight[v-1] : poids du sommet v (ex. distribution stationnaire), NULL = pas de flux
+void build_class_links_weighted(const AdjList *g, const Partition *p, const float *vertex_weight,
+                                HasseLinkArray *out_links);
+
+void build_condensation(const AdjList *g, const Partition *p, t_condensation *out);
+void build_condensation_weighted(const AdjList *g, const Partition *p, const float *vertex_weight,
+                                 t_condensation *out);
+void condensation_free(t_condensation *c);
 
 void remove_transitive_links(HasseLinkArray *links, int nb_classes);
+void remove_transitive_links_lowmem(HasseLinkArray *links, int nb_classes);
 
 void hasse_init_links(HasseLinkArray *arr);
 void hasse_free_links(HasseLinkArray *arr);
@@ -0,0 +1,27 @@
+#ifndef HITTING_H
+#define HITTING_H
+#include "graph.h"
+#include "scc.h"
+#include "linsolve.h"
+
+// Tolérance relative et itérations max du système des temps d'atteinte
+#define HIT_TOL       1e-9
+#define HIT_MAX_ITER  10000
+
+// Statut de chaque sommet pour --hitting-times
+typedef enum {
+    HIT_TARGET,       // sommet cible : temps 0
+    HIT_FINITE,       // cibles atteintes presque sûrement : temps moyen fini
+    HIT_UNREACHABLE,  // aucune cible atteignable (classe écartée via la partition)
+    HIT_ESCAPE        // cible atteignable, mais pas presque sûrement : temps infini
+} t_hit_status;
+
+// Temps moyen d'atteinte de l'ensemble cible depuis chaque sommet :
+// h(v) = 0 sur les cibles, h(v) = 1 + somme_w P(v,w) h(w) ailleurs.
+// is_target, h, status : tableaux [size+1] indexés par sommet (1..size) ;
+// h[v] n'a de sens que pour HIT_TARGET et HIT_FINITE.
+// Retour : 1 si convergé, 0 sinon, -1 si le système est invalide.
+int hitting_times(const AdjList *g, const Partition *p, const unsigned char *is_target,
+                  double tol, int max_iter, double *h, unsigned char *status, t_solve_info *info);
+
+#endif
@@ -3,12 +3,57 @@
 
 #include "graph.h"
 
-// Lit un fichier texte et construit le graphe 'out'.
-// Format attendu :
+// Lit un fichier et construit le graphe 'out'. Le format est détecté à la
+// signature : binaire .mgb (voir write_graph_binary) ou texte.
+// Format texte attendu :
 //   N
 //   from to proba
 //   ...
+// Le fichier est projeté en mémoire (mmap) et analysé sans sscanf : pas de
+// limite de longueur de ligne, séparateur décimal '.' quelle que soit la locale.
+// Lignes vides et commentaires (# ou //) ignorés ; les lignes invalides sont
+// signalées sur stderr avec leur numéro de ligne puis ignorées.
 // En cas d'erreur IO/format, affiche un message et exit(EXIT_FAILURE).
 void read_graph_from_file(const char *filename, AdjList *out);
 
+// Idem, en découpant le fichier en morceaux analysés par 'nthreads' threads.
+// Graphe et diagnostics sont identiques à la lecture séquentielle.
+void read_graph_from_file_mt(const char *filename, AdjList *out, int nthreads);
+
+// Écrit le graphe au format binaire .mgb : en-tête (signature, version, N,
+// nombre d'arêtes) puis offsets int64 par sommet, destinations int32 et
+// probabilités float. Retourne 0 si succès, -1 sinon.
+int write_graph_binary(const AdjList *g, const char *outfile);
+
+// Distributions initiales multiples (--dist-start, --dist-start-file), au
+// format creux : la distribution s est portée par les entrées
+// [ptr[s], ptr[s+1]) de vert/p (sommets 1..N, masses non normalisées).
+typedef struct {
+    int      count;      // nombre de distributions
+    int64_t *ptr;        // taille count+1
+    int     *vert;       // sommets
+    float   *p;          // masses
+    int      cap_count;  // capacités allouées (interne)
+    int64_t  cap_nnz;
+} t_dist_starts;
+
+void dist_starts_init(t_dist_starts *ds);
+void dist_starts_free(t_dist_starts *ds);
+
+// Ajoute à 'ds' une distribution concentrée par sommet de la liste
+// "V[,V|A-B...]" (ex. "1,4,10-20"). Les éléments invalides ou hors [1 ; N]
+// sont signalés sur stderr et ignorés ; retourne leur nombre.
+int parse_dist_start_list(const char *list, int n, t_dist_starts *ds);
+
+// Marque mark[v] = 1 (tableau de n+1 octets) pour chaque sommet de la liste
+// "V[,V|A-B...]". Éléments invalides signalés (au nom de option) et ignorés ;
+// retourne leur nombre.
+int parse_vertex_set(const char *list, int n, const char *option, unsigned char *mark);
+
+// Ajoute à 'ds' une distribution par ligne du fichier : "V" (tout en V) ou
+// "V p V p ..." (masse p sur chaque V). Lignes vides et commentaires ignorés,
+// lignes invalides signalées avec leur numéro puis ignorées. Retourne le
+// nombre de lignes rejetées, -1 si le fichier ne peut pas être ouvert.
+int read_dist_starts(const char *filename, int n, t_dist_starts *ds);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifndef LIMIT_H
+#define LIMIT_H
+#include "graph.h"
+#include "scc.h"
+#include "matrix.h"
+#include "stationary.h"
+#include "absorption.h"
+
+// Tolérance des stationnaires pour --limit (--eps, 0.01 par défaut, est trop lâche)
+#define LIMIT_EPS 1e-7f
+
+// Matrice limite de Cesàro  Pi = lim (1/N) somme_{k<N} P^k,  gardée sous
+// forme factorisée (O(n + états transitoires × cibles atteignables) au lieu de n²) :
+//   Pi[i][j] = pi[j] · a(i, classe de j)
+// pi : stationnaire de la classe persistante de j (0 si j transitoire),
+// a = 1 si i est dans cette classe, probabilité d'absorption si i est
+// transitoire, 0 sinon. Existe aussi pour les classes périodiques.
+typedef struct {
+    int           n;          // nombre d'états
+    float        *pi;         // [n+1] stationnaire de la classe de chaque état (0 si transitoire)
+    int          *target_of;  // [n+1] indice de cible (classe persistante), -1 si transitoire
+    t_absorption  abs;        // absorption des états transitoires (cibles dans le même ordre)
+    int           converged;  // 1 si toutes les résolutions ont convergé
+} t_limit;
+
+// Une résolution stationnaire par classe persistante (S : matrice creuse
+// de transition, solver/eps/max_iter/omega comme stationary_solve), puis
+// l'absorption des états transitoires. Retour : 1 si convergé, 0 sinon.
+int    limit_build(const AdjList *g, const Partition *p, const int *is_persistent, const t_spmatrix *S,
+                   t_stat_solver solver, float eps, int max_iter, double omega, t_limit *out);
+void   limit_free(t_limit *L);
+
+// Coefficient Pi[i][j] (états 1..n), en O(1)
+double limit_entry(const t_limit *L, int i, int j);
+
+// Forme dense n×n (out est réalloué)
+void   limit_to_dense(const t_limit *L, t_matrix *out);
+
+// max_{i,j} |M[i][j] - Pi[i][j]| : validation contre une puissance dense
+double limit_max_diff(const t_limit *L, const t_matrix *M);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef LINSOLVE_H
+#define LINSOLVE_H
+#include "matrix.h"
+
+// Bilan d'une résolution itérative
+typedef struct {
+    int    iters;      // itérations (balayages, ou pas de BiCGSTAB) effectuées
+    double residual;   // norme L1 du résidu final
+    int    converged;  // 1 si residual <= tol · ||b||_1
+} t_solve_info;
+
+// Systèmes (I - A) x = b, A creuse n×n (CSR, lue ligne par ligne) avec
+// 1 - A[i][i] > 0 : typiquement A = Q bloc sous-stochastique d'une chaîne,
+// ou sa transposée. Calculs en double, x contient l'itéré de départ.
+// Retour : 1 si convergé, 0 sinon, -1 si le système est invalide.
+
+// Gauss-Seidel (omega = 1) ou SOR (0 < omega < 2)
+int sp_solve_sor(const t_spmatrix *A, const double *b, double *x,
+                 double omega, double tol, int max_iter, t_solve_info *info);
+
+// Gauss-Seidel / SOR sur nrhs seconds membres à la fois : B et X sont
+// rangés par ligne (n × nrhs), un balayage lit A une seule fois pour tous.
+// Convergence : somme des résidus L1 <= tol · ||B||_1.
+int sp_solve_sor_multi(const t_spmatrix *A, const double *B, double *X, int nrhs,
+                       double omega, double tol, int max_iter, t_solve_info *info);
+
+// BiCGSTAB préconditionné par la diagonale de I - A
+int sp_solve_bicgstab(const t_spmatrix *A, const double *b, double *x,
+                      double tol, int max_iter, t_solve_info *info);
+
+// BiCGSTAB redémarré tous les restart pas depuis le meilleur itéré ; arrêt
+// dès qu'un cycle n'améliore plus le résidu (x ne se dégrade jamais)
+int sp_solve_bicgstab_restarted(const t_spmatrix *A, const double *b, double *x,
+                                double tol, int max_iter, int restart, t_solve_info *info);
+
+#endif
@@ -13,4 +13,25 @@ int markov_is_irreducible(const Partition *p);
 // Retourne 1 si l'état v est absorbant (classe persistante de taille 1 et v l’unique)
 int markov_is_absorbing_vertex(const Partition *p, const HasseLinkArray *links, int v);
 
+// Table des propriétés de classes, calculée une fois pour des requêtes en O(1)
+typedef struct {
+    int  nb_classes;
+    int *size;           // [nb_classes] nombre de sommets de la classe
+    int *out_degree;     // [nb_classes] liens sortants vers d'autres classes
+    int *is_persistent;  // [nb_classes] 1 si aucun lien sortant, 0 sinon
+    const int *class_of; // vue sur p->class_of (indexé 1..class_of_len-1)
+    int  class_of_len;
+} t_class_props;
+
+// Construit la table depuis la partition et les liens (O(N + L)).
+// class_of reste une vue : la partition doit survivre à la table.
+void markov_class_props_build(const Partition *p, const HasseLinkArray *links, t_class_props *out);
+void markov_class_props_free(t_class_props *props);
+
+// Classe du sommet v (0..nb_classes-1), -1 si absent
+int markov_props_class_of(const t_class_props *props, int v);
+
+// Même résultat que markov_is_absorbing_vertex, en O(1)
+int markov_props_is_absorbing(const t_class_props *props, int v);
+
 #endif
\ No newline at end of file
@@ -8,12 +8,25 @@ typedef struct {
     float **a;      // a[i][j]
 } t_matrix;
 
+// Matrice creuse au format CSR : les coefficients de la ligne i occupent les
+// indices [row_ptr[i], row_ptr[i+1]) de col/val (colonnes 0..n-1)
+typedef struct {
+    int      n;         // taille n x n
+    int64_t  nnz;       // nombre de coefficients stockés
+    int64_t *row_ptr;   // taille n+1
+    int     *col;       // indices de colonne, taille nnz
+    float   *val;       // valeurs, taille nnz
+} t_spmatrix;
+
 t_matrix mx_from_adjlist(const AdjList *g);
 t_matrix mx_zeros(int n);
 void     mx_copy(const t_matrix *src, t_matrix *dst);
 void     mx_mul(const t_matrix *A, const t_matrix *B, t_matrix *C);
+void     mx_power_int(const t_matrix *M, int k, t_matrix *out);
 float    mx_diff_abs1(const t_matrix *M, const t_matrix *N);
 void     mx_free(t_matrix *M);
+void     mx_set_threads(int nthreads);
+int      mx_get_threads(void);
 
 void dist_step(const float *pi0, const t_matrix *M, float *pi1);
 void dist_power(const float *pi0, const t_matrix *M, int t, float *pit);
@@ -21,7 +34,27 @@ void mx_print(const t_matrix *M);
 
 t_matrix subMatrix(t_matrix matrix, Partition part, int compo_index);
 
+// max_iter est ramené à MX_POWER_MAX_ITER : n = max_iter + 1 tient dans un int
+// et les carrés M^(2^j) de la recherche par dichotomie dans 30 niveaux
+#define MX_POWER_MAX_ITER ((1 << 30) - 1)
 int mx_power_until_diff(const t_matrix *M, float eps, int max_iter, t_matrix *out, int *iters_done);
+// Même résultat par carrés successifs puis dichotomie : O(log n) produits au lieu de n
+int mx_power_until_diff_squaring(const t_matrix *M, float eps, int max_iter, t_matrix *out, int *iters_done);
 int stationary_distribution(const t_matrix *MC, float eps, int max_iter, float *pi_out);
 
+// Variantes creuses : coût O(nnz) par étape, résultats identiques aux versions denses
+t_spmatrix spmx_from_adjlist(const AdjList *g);
+t_spmatrix spmx_sub(const t_spmatrix *S, Partition part, int compo_index);
+t_matrix   spmx_to_dense(const t_spmatrix *S);
+void       spmx_free(t_spmatrix *S);
+
+void dist_step_sp(const float *pi0, const t_spmatrix *S, float *pi1);
+void dist_power_sp(const float *pi0, const t_spmatrix *S, int t, float *pit);
+// Bloc de b distributions (n×b, P[i*b + s]) : S parcourue une fois par étape pour tout le bloc
+void dist_step_sp_block(const float *P0, const t_spmatrix *S, int b, float *P1);
+void dist_power_sp_block(const float *P0, const t_spmatrix *S, int b, int t, float *Pt);
+int  stationary_distribution_sp(const t_spmatrix *SC, float eps, int max_iter, float *pi_out);
+// Idem, avec le nombre d'itérations effectuées (iters_done peut être NULL)
+int  stationary_power_sp(const t_spmatrix *SC, float eps, int max_iter, float *pi_out, int *iters_done);
+
 #endif
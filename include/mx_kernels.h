@@ -0,0 +1,38 @@
+#ifndef MX_KERNELS_H
+#define MX_KERNELS_H
+#include <stddef.h>
+
+// Noyaux de produits denses n×n (matrice × matrice, vecteur × matrice ; float,
+// stockage ligne par ligne contigu). Tous les noyaux accumulent chaque
+// coefficient dans le même ordre (k croissant, sans FMA) : leurs résultats
+// sont identiques bit à bit.
+typedef enum {
+    MX_KERNEL_AUTO = 0,   // meilleur noyau disponible sur la machine
+    MX_KERNEL_NAIVE,      // triple boucle i-j-k d'origine (référence)
+    MX_KERNEL_PORTABLE,   // boucle par blocs en C pur
+    MX_KERNEL_SSE,
+    MX_KERNEL_AVX2,
+    MX_KERNEL_AVX512,
+    MX_KERNEL_COUNT
+} t_mx_kernel;
+
+int         mx_kernel_supported(t_mx_kernel k);
+int         mx_kernel_select(t_mx_kernel k);
+t_mx_kernel mx_kernel_active(void);
+const char *mx_kernel_name(t_mx_kernel k);
+
+void mx_kernel_mul(const float *A, const float *B, float *C, int n, int row_begin, int row_end);
+void mx_kernel_vecmat(const float *x, const float *A, float *y, int n);
+
+// Normes L1 : élément j accumulé dans la voie j % MX_L1_LANES, voies sommées
+// dans l'ordre. Même résultat pour tous les noyaux (voies fixes, pas la
+// largeur SIMD).
+#define MX_L1_LANES 16
+
+// y = x × A (comme mx_kernel_vecmat) et ||y - x||_1 en une seule passe sur y
+float mx_kernel_vecmat_l1(const float *x, const float *A, float *y, int n);
+float mx_kernel_diff_l1(const float *a, const float *b, size_t len);
+// ||a - b||_1 et b remis à zéro dans la même passe (itérations par diffusion)
+float mx_kernel_diff_l1_clear(const float *a, float *b, size_t len);
+
+#endif
@@ -1,8 +1,16 @@
 #ifndef PERIOD_H
 #define PERIOD_H
 #include "matrix.h"
+#include "graph.h"
+#include "scc.h"
 
 int class_period(const t_matrix *MC);
 int class_has_unique_stationary(const t_matrix *MC); // période == 1 ?
 
+// Période de toutes les classes en O(N + M) sur le graphe creux (parcours en
+// largeur par classe). period[k] pour k = 0..p->count-1 ; si subclass n'est
+// pas NULL, subclass[v] (v = 1..N) reçoit la sous-classe cyclique de v
+// (0..period-1) : les arcs internes vont de la sous-classe r à r+1 mod d.
+void class_periods(const AdjList *g, const Partition *p, int *period, int *subclass);
+
 #endif
@@ -3,25 +3,45 @@
 
 #include "graph.h"
 
-// Struct pour représenter une partition en composantes fortement connexes
+// Struct pour représenter une classe (CFC) : tableau de sommets
+// Dans une Partition, vue en lecture sur 'members' (voir scc_class)
 typedef struct {
     int *verts;      // ids des sommets (1..N)
     int  count;      // nombre d'éléments
-    int  capacity;
+    int  capacity;   // 0 pour une vue sur une partition
 } SccClass;
 
-// Struct pour représenter une partition complète
+// Struct pour représenter une partition complète, à plat (format CSR) :
+// la classe k est members[class_offsets[k] .. class_offsets[k+1]-1]
 typedef struct {
-    SccClass *classes;
-    int       count;
-    int       capacity;
+    int *members;        // sommets (1..N) rangés classe par classe
+    int *class_offsets;  // [count+1] débuts des classes dans 'members'
+    int *class_of;       // [1..class_of_len-1] indice de classe du sommet, -1 si absent
+    int  count;          // nombre de classes
+    int  capacity;       // capacité de class_offsets (sentinelle non comprise)
+    int  n_members;      // nombre de sommets rangés
+    int  members_cap;
+    int  class_of_len;
 } Partition;
 
 // utilitaires allocation/libération
 void     scc_init_partition(Partition *p);
 void     scc_free_partition(Partition *p);
+void     scc_reserve_partition(Partition *p, int n);
+
+// construction en une passe : sommets de la classe en cours, puis fermeture
+void     scc_push_member(Partition *p, int v);
+void     scc_close_class(Partition *p);
+
+// construction depuis label[v-1] dans 0..nclasses-1 (sommets croissants par classe)
+void     scc_partition_from_labels(Partition *p, const int *label, int n, int nclasses);
+
+// construction classe par classe (compatibilité) : c.verts est copié puis libéré
 void     scc_add_vertex(SccClass *c, int v);
 SccClass scc_make_empty_class(void);
 void     scc_add_class(Partition *p, SccClass c);
 
+// Vue sur la classe k (0..count-1), valable jusqu'à la prochaine modification de p
+SccClass scc_class(const Partition *p, int k);
+
 #endif
@@ -0,0 +1,13 @@
+#ifndef SCC_PARALLEL_H
+#define SCC_PARALLEL_H
+
+#include "graph.h"
+#include "scc.h"
+
+// Décomposition en CFC multi-thread (élagage, avant-arrière depuis un pivot,
+// coloration), même partition que tarjan_partition. Ordre déterministe,
+// indépendant du nombre de threads : classes rangées par plus petit sommet,
+// sommets croissants dans chaque classe.
+void scc_partition_parallel(const AdjList *g, Partition *out, int nthreads);
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef SCC_PEARCE_H
+#define SCC_PEARCE_H
+
+#include "graph.h"
+#include "scc.h"
+
+// Décomposition en CFC à mémoire réduite (variante de Pearce de Tarjan) :
+// un seul entier 'rindex' par sommet et un bit "racine", au lieu des 16 octets
+// de t_tarjan_vertex. Mêmes classes, dans le même ordre, que tarjan_partition.
+void scc_partition_pearce(const AdjList *g, Partition *out);
+
+#endif
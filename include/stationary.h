@@ -0,0 +1,35 @@
+#ifndef STATIONARY_H
+#define STATIONARY_H
+#include "matrix.h"
+#include "linsolve.h"
+
+// Solveurs de distribution stationnaire d'une classe persistante (--stationary-solver)
+typedef enum {
+    STAT_POWER,     // itération de la puissance depuis la loi uniforme (historique)
+    STAT_GTH,       // élimination GTH (LU sans soustraction), dense, petites classes
+    STAT_GS,        // Gauss-Seidel creux (colonnes de P), normalisé à chaque balayage
+    STAT_SOR,       // idem avec relaxation omega
+    STAT_BICGSTAB,  // BiCGSTAB préconditionné sur le système réduit creux
+    STAT_AUTO       // GTH jusqu'à STAT_GTH_MAX_N états, BiCGSTAB (repli Gauss-Seidel) au-delà
+} t_stat_solver;
+
+// Taille maximale d'une classe pour GTH en mode auto (n² doubles)
+#define STAT_GTH_MAX_N 1024
+
+int         stationary_solver_parse(const char *name, t_stat_solver *out);
+const char *stationary_solver_name(t_stat_solver s);
+
+// Distribution stationnaire de SC (classe irréductible) avec le solveur demandé.
+// eps : tolérance (écart entre itérés pour power, résidu sinon),
+// omega : relaxation de STAT_SOR. info->residual = ||pi SC - pi||_1.
+// Retour : 1 si convergé, 0 sinon.
+int stationary_solve(const t_spmatrix *SC, t_stat_solver solver, float eps, int max_iter,
+                     double omega, float *pi_out, t_solve_info *info);
+
+// GTH sur une matrice creuse convertie en dense (O(n³), O(n²) mémoire)
+int stationary_gth(const t_spmatrix *SC, float *pi_out, t_solve_info *info);
+
+// ||pi S - pi||_1 pour pi de somme 1
+double stationary_residual(const t_spmatrix *SC, const float *pi);
+
+#endif
@@ -22,9 +22,16 @@ typedef struct {
     int cap;            // capacité pile
     int N;              // nombre de sommets
     int next_index;     // compteur d'index
+    int *call;          // pile d'appels explicite : sommets en cours d'exploration
+    int64_t *call_edge; // prochaine arête à explorer pour chaque cadre de 'call'
 } t_ctx;
 
 // Lance Tarjan sur g et remplit 'out' avec la partition (ordre des classes indifférent)
+// Parcours itératif (pile explicite), sans limite de profondeur
 void tarjan_partition(const AdjList *g, Partition *out);
 
+// Variante récursive d'origine (référence et benchmarks) : même partition, même
+// ordre des classes, mais déborde la pile système sur les graphes profonds
+void tarjan_partition_recursive(const AdjList *g, Partition *out);
+
 #endif
\ No newline at end of file
@@ -16,4 +16,7 @@ int near_one(float s, float eps);
 // crée récursivement un répertoire si nécessaire (best-effort, ok si absent)
 int ensure_dir(const char *path);
 
+// pic de mémoire résidente du processus (Ko), -1 si indisponible
+long peak_rss_kb(void);
+
 #endif
\ No newline at end of file
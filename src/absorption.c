@@ -0,0 +1,375 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "absorption.h"
+#include "hasse.h"
+
+/*
+ * Absorption d'une chaîne réductible. Q est la restriction de P aux états
+ * transitoires, R[i][t] la probabilité de passer en un pas de l'état i dans
+ * la classe persistante t. Les probabilités d'absorption B et les temps
+ * moyens t vérifient
+ *     (I - Q) B = R,     (I - Q) t = 1,
+ * résolus ensemble comme un seul système à plusieurs seconds membres : une
+ * colonne par classe persistante atteignable depuis la classe, plus t.
+ *
+ * Q est triangulaire par blocs dans l'ordre topologique des classes : en
+ * traitant les classes transitoires des puits vers les sources, les arcs
+ * vers une autre classe transitoire pointent vers des lignes déjà
+ * résolues et passent au second membre. Il ne reste qu'un système par
+ * classe, (I - Q_kk) X_k = B_k, résolu par Gauss-Seidel multi-seconds
+ * membres (sp_solve_sor_multi), avec repli BiCGSTAB s'il stagne ; une
+ * classe d'un seul état se résout par une division. Chaque ligne ne
+ * range que les cibles atteignables depuis sa classe (format CSR) :
+ * mémoire O(nnz + somme des états × cibles atteignables), jamais
+ * n_states · n_targets ni n².
+ */
+
+static void *xmalloc(size_t sz) {
+    void *q = malloc(sz ? sz : 1);
+    if (!q) {
+        perror("malloc(absorption)");
+        exit(EXIT_FAILURE);
+    }
+    return q;
+}
+
+// Itérations de BiCGSTAB entre deux redémarrages depuis le meilleur itéré
+#define ABSORB_RESTART 200
+
+/**
+ * @brief  Repli BiCGSTAB, colonne par colonne, depuis l'itéré de Gauss-Seidel
+ *
+ * Gauss-Seidel stagne quand la classe fuit très peu (longue chaîne de
+ * naissance-mort, classe presque fermée) ; BiCGSTAB y converge en bien
+ * moins d'itérations mais ne traite qu'un second membre à la fois.
+ *
+ * @return  1 si toutes les colonnes ont convergé, 0 sinon
+ */
+static int bicgstab_columns(const t_spmatrix *A, const double *B, double *X, int nrhs,
+                            double tol, int max_iter, t_solve_info *info) {
+    int m = A->n;
+    double *b = xmalloc((size_t)m * sizeof(double));
+    double *x = xmalloc((size_t)m * sizeof(double));
+    int all = 1;
+    double residual = 0.0;
+    for (int c = 0; c < nrhs; ++c) {
+        for (int i = 0; i < m; ++i) {
+            b[i] = B[(size_t)i * nrhs + c];
+            x[i] = X[(size_t)i * nrhs + c];
+        }
+        t_solve_info ci;
+        if (sp_solve_bicgstab_restarted(A, b, x, tol, max_iter, ABSORB_RESTART, &ci) != 1) all = 0;
+        for (int i = 0; i < m; ++i) X[(size_t)i * nrhs + c] = x[i];
+        info->iters += ci.iters;
+        residual += ci.residual;
+    }
+    info->residual = residual;
+    info->converged = all;
+    free(x);
+    free(b);
+    return all;
+}
+
+static int cmp_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief  Cibles atteignables depuis chaque classe transitoire
+ *
+ * Union des cibles des successeurs dans le graphe de condensation, des
+ * puits vers les sources : chaque successeur transitoire est déjà traité.
+ * Les cibles de la classe k sont list[start[k] .. start[k] + len[k] - 1],
+ * en ordre croissant.
+ *
+ * @param[in]  cond       Graphe de condensation
+ * @param[in]  target_of  [nb_classes] indice de cible, -1 si transitoire
+ * @param[in]  nt         Nombre de cibles
+ * @param[out] start      [nb_classes] début de la liste de chaque classe
+ * @param[out] len        [nb_classes] taille de la liste (0 si persistante)
+ *
+ * @return  Listes concaténées (à libérer)
+ */
+static int *reachable_targets(const t_condensation *cond, const int *target_of, int nt,
+                              int64_t *start, int *len) {
+    int nc = cond->n;
+    int *mark = xmalloc((size_t)nt * sizeof(int));
+    for (int t = 0; t < nt; ++t) mark[t] = -1;
+    int64_t cap = 16, used = 0;
+    int *list = xmalloc((size_t)cap * sizeof(int));
+
+    for (int r = nc - 1; r >= 0; --r) {
+        int k = cond->topo[r];
+        start[k] = used;
+        len[k] = 0;
+        if (target_of[k] >= 0) continue;
+        // Au plus la somme des listes des successeurs : réserve avant de lire
+        int64_t need = used;
+        for (int64_t e = cond->offsets[k]; e < cond->offsets[k + 1]; ++e) {
+            int s = cond->succ[e];
+            need += target_of[s] >= 0 ? 1 : len[s];
+        }
+        if (need > cap) {
+            while (cap < need) cap *= 2;
+            int *nl = realloc(list, (size_t)cap * sizeof(int));
+            if (!nl) {
+                perror("realloc(absorption)");
+                exit(EXIT_FAILURE);
+            }
+            list = nl;
+        }
+        for (int64_t e = cond->offsets[k]; e < cond->offsets[k + 1]; ++e) {
+            int s = cond->succ[e];
+            const int *src = target_of[s] >= 0 ? &target_of[s] : list + start[s];
+            int cnt = target_of[s] >= 0 ? 1 : len[s];
+            for (int j = 0; j < cnt; ++j) {
+                int t = src[j];
+                if (mark[t] == k) continue;
+                mark[t] = k;
+                list[used++] = t;
+                len[k]++;
+            }
+        }
+        qsort(list + start[k], (size_t)len[k], sizeof(int), cmp_int);
+    }
+    free(mark);
+    return list;
+}
+
+/**
+ * @brief  Résout le bloc d'une classe transitoire et range le résultat
+ *
+ * Les lignes row0 .. row0 + m - 1 de out correspondent aux sommets de la
+ * classe, dans l'ordre de la partition ; les lignes des classes en aval
+ * sont déjà calculées. Une colonne par cible atteignable, plus le temps.
+ *
+ * @param[in]     g          Graphe
+ * @param[in]     c          Classe transitoire à résoudre
+ * @param[in]     k          Indice de la classe
+ * @param[in]     class_of   Classe de chaque sommet (p->class_of)
+ * @param[in]     target_of  [nb_classes] indice de cible, -1 si transitoire
+ * @param[in]     tl         Cibles atteignables depuis la classe (croissantes)
+ * @param[in]     nr         Nombre de cibles atteignables
+ * @param[in,out] col_of     [n_targets] scratch : colonne de chaque cible
+ * @param[in]     row0       Première ligne de la classe
+ * @param[in,out] out        Résultat en cours de remplissage
+ * @param[in]     tol        Tolérance relative
+ * @param[in]     max_iter   Balayages max
+ *
+ * @return  1 si convergé, 0 sinon, -1 si un pivot 1 - Q[i][i] est <= 0
+ */
+static int solve_class(const AdjList *g, SccClass c, int k, const int *class_of, const int *target_of,
+                       const int *tl, int nr, int *col_of, int row0, t_absorption *out,
+                       double tol, int max_iter) {
+    int m = c.count;
+    int nrhs = nr + 1;
+    for (int j = 0; j < nr; ++j) col_of[tl[j]] = j;
+    double *B = xmalloc((size_t)m * nrhs * sizeof(double));
+    double *X = xmalloc((size_t)m * nrhs * sizeof(double));
+
+    int64_t internal = 0;
+    for (int i = 0; i < m; ++i) {
+        int v = c.verts[i];
+        for (int64_t e = g->offsets[v - 1]; e < g->offsets[v]; ++e) {
+            internal += (class_of[g->dests[e]] == k);
+        }
+    }
+
+    t_spmatrix A;
+    A.n = m;
+    A.nnz = internal;
+    A.row_ptr = xmalloc(((size_t)m + 1) * sizeof(int64_t));
+    A.col = xmalloc((size_t)internal * sizeof(int));
+    A.val = xmalloc((size_t)internal * sizeof(float));
+
+    // Second membre : arcs vers les cibles, puis vers les lignes déjà résolues
+    int64_t pos = 0;
+    A.row_ptr[0] = 0;
+    for (int i = 0; i < m; ++i) {
+        int v = c.verts[i];
+        double *bi = B + (size_t)i * nrhs;
+        memset(bi, 0, (size_t)nr * sizeof(double));
+        bi[nr] = 1.0;
+        for (int64_t e = g->offsets[v - 1]; e < g->offsets[v]; ++e) {
+            int w = g->dests[e];
+            int kw = class_of[w];
+            double q = (double)g->probas[e];
+            if (kw == k) {
+                A.col[pos] = out->row_of[w] - row0;
+                A.val[pos] = g->probas[e];
+                pos++;
+            } else if (target_of[kw] >= 0) {
+                bi[col_of[target_of[kw]]] += q;
+            } else {
+                // Cibles de w incluses dans celles de la classe
+                int rw = out->row_of[w];
+                for (int64_t x = out->row_ptr[rw]; x < out->row_ptr[rw + 1]; ++x) {
+                    bi[col_of[out->tgt[x]]] += q * out->prob[x];
+                }
+                bi[nr] += q * out->steps[rw];
+            }
+        }
+        A.row_ptr[i + 1] = pos;
+    }
+
+    int rc;
+    t_solve_info *info = &out->class_info[k];
+    if (m == 1) {
+        double d = 1.0;
+        for (int64_t e = 0; e < A.nnz; ++e) d -= (double)A.val[e];
+        rc = (d > 0.0) ? 1 : -1;
+        for (int r = 0; r < nrhs; ++r) X[r] = (rc == 1) ? B[r] / d : 0.0;
+        info->iters = 1;
+        info->residual = 0.0;
+        info->converged = (rc == 1);
+    } else {
+        memset(X, 0, (size_t)m * nrhs * sizeof(double));
+        rc = sp_solve_sor_multi(&A, B, X, nrhs, 1.0, tol, max_iter, info);
+        if (rc == 0) {
+            rc = bicgstab_columns(&A, B, X, nrhs, tol, max_iter, info);
+        }
+    }
+
+    for (int i = 0; i < m; ++i) {
+        const double *xi = X + (size_t)i * nrhs;
+        int64_t base = out->row_ptr[row0 + i];
+        memcpy(out->tgt + base, tl, (size_t)nr * sizeof(int));
+        memcpy(out->prob + base, xi, (size_t)nr * sizeof(double));
+        out->steps[row0 + i] = xi[nr];
+    }
+
+    spmx_free(&A);
+    free(X);
+    free(B);
+    return rc;
+}
+
+/**
+ * @brief  Probabilités et temps moyens d'absorption des états transitoires
+ *
+ * Les cibles sont les classes persistantes, dans l'ordre des indices de
+ * classe. Les classes transitoires sont résolues dans l'ordre topologique
+ * inverse du graphe de condensation (build_condensation), chacune sur les
+ * seules cibles qu'elle peut atteindre.
+ *
+ * @param[in]  g              Graphe
+ * @param[in]  p              Partition en classes
+ * @param[in]  is_persistent  [p->count] 1 si la classe est persistante
+ * @param[in]  tol            Tolérance relative (ex. ABSORB_TOL)
+ * @param[in]  max_iter       Balayages max par classe (ex. ABSORB_MAX_ITER)
+ * @param[out] out            Résultat (à libérer par absorption_free)
+ *
+ * @return  1 si toutes les classes ont convergé, 0 sinon, -1 si une ligne
+ *          du graphe rend I - Q singulière (somme sortante > 1)
+ */
+int absorption_compute(const AdjList *g, const Partition *p, const int *is_persistent,
+                       double tol, int max_iter, t_absorption *out) {
+    int nc = p->count;
+    memset(out, 0, sizeof(*out));
+
+    int *target_of = xmalloc((size_t)nc * sizeof(int));
+    int nt = 0;
+    for (int k = 0; k < nc; ++k) {
+        target_of[k] = is_persistent[k] ? nt++ : -1;
+    }
+    out->n_targets = nt;
+    out->target_class = xmalloc((size_t)nt * sizeof(int));
+    for (int k = 0; k < nc; ++k) {
+        if (target_of[k] >= 0) out->target_class[target_of[k]] = k;
+    }
+
+    t_condensation cond;
+    build_condensation(g, p, &cond);
+
+    int64_t *reach_start = xmalloc((size_t)nc * sizeof(int64_t));
+    int *reach_len = xmalloc((size_t)nc * sizeof(int));
+    int *reach = reachable_targets(&cond, target_of, nt, reach_start, reach_len);
+
+    // Lignes attribuées classe par classe, des puits vers les sources ;
+    // une entrée par cible atteignable
+    out->row_of = xmalloc(((size_t)g->size + 1) * sizeof(int));
+    for (int v = 0; v <= g->size; ++v) out->row_of[v] = -1;
+    int rows = 0;
+    for (int r = nc - 1; r >= 0; --r) {
+        int k = cond.topo[r];
+        if (target_of[k] >= 0) continue;
+        SccClass c = scc_class(p, k);
+        for (int i = 0; i < c.count; ++i) out->row_of[c.verts[i]] = rows++;
+    }
+    out->n_states = rows;
+    out->row_ptr = xmalloc(((size_t)rows + 1) * sizeof(int64_t));
+    out->row_ptr[0] = 0;
+    for (int r = nc - 1, row = 0; r >= 0; --r) {
+        int k = cond.topo[r];
+        if (target_of[k] >= 0) continue;
+        int cnt = scc_class(p, k).count;
+        for (int i = 0; i < cnt; ++i, ++row) out->row_ptr[row + 1] = out->row_ptr[row] + reach_len[k];
+    }
+    out->nnz = out->row_ptr[rows];
+    out->tgt = xmalloc((size_t)out->nnz * sizeof(int));
+    out->prob = xmalloc((size_t)out->nnz * sizeof(double));
+    out->steps = xmalloc((size_t)rows * sizeof(double));
+    int *col_of = xmalloc((size_t)nt * sizeof(int));
+    out->class_info = xmalloc((size_t)nc * sizeof(t_solve_info));
+    memset(out->class_info, 0, (size_t)nc * sizeof(t_solve_info));
+
+    int result = 1;
+    for (int r = nc - 1; r >= 0; --r) {
+        int k = cond.topo[r];
+        if (target_of[k] >= 0) continue;
+        SccClass c = scc_class(p, k);
+        int rc = solve_class(g, c, k, p->class_of, target_of, reach + reach_start[k], reach_len[k], col_of,
+                             out->row_of[c.verts[0]], out, tol, max_iter);
+        if (rc < 0) {
+            result = -1;
+        } else if (rc == 0 && result == 1) {
+            result = 0;
+        }
+    }
+
+    condensation_free(&cond);
+    free(col_of);
+    free(reach);
+    free(reach_len);
+    free(reach_start);
+    free(target_of);
+    return result;
+}
+
+/**
+ * @brief  Probabilité d'absorption d'un état transitoire dans une cible
+ *
+ * Recherche dichotomique dans la ligne (cibles croissantes).
+ *
+ * @param[in]  a  Résultat de absorption_compute
+ * @param[in]  v  État (1..size)
+ * @param[in]  t  Indice de cible (0..n_targets-1)
+ *
+ * @return  Probabilité, 0 si v est persistant ou si t n'est pas atteignable
+ */
+double absorption_prob(const t_absorption *a, int v, int t) {
+    int row = a->row_of[v];
+    if (row < 0) return 0.0;
+    int64_t lo = a->row_ptr[row], hi = a->row_ptr[row + 1];
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (a->tgt[mid] < t) lo = mid + 1;
+        else hi = mid;
+    }
+    return (lo < a->row_ptr[row + 1] && a->tgt[lo] == t) ? a->prob[lo] : 0.0;
+}
+
+void absorption_free(t_absorption *a) {
+    if (!a) return;
+    free(a->target_class);
+    free(a->row_of);
+    free(a->row_ptr);
+    free(a->tgt);
+    free(a->prob);
+    free(a->steps);
+    free(a->class_info);
+    memset(a, 0, sizeof(*a));
+}
@@ -1,31 +1,37 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+  #include <sys/mman.h> // munmap
+#endif
 #include "graph.h"
-#include "list.h"
 
 /**
  * @brief        Fonction qui initialise un graph de taille n
  *
+ * Le graphe est créé sans arête : tous les offsets valent 0.
+ *
  * @param g      Pointeur vers le graphe g (structure AdjList)
  * @param n      Taille de g (nombre de sommets)
  */
 void graph_init(AdjList *g, int n){
     // 1. Stocke le nombre de sommets dans la structure du graphe
     g->size = n;
-    
-    // 2. Alloue dynamiquement un tableau de 'n' listes (une liste par sommet)
-    g->array = malloc(n * sizeof(List));
+    g->nnz = 0;
+    g->cap = 0;
+    g->dests = NULL;
+    g->probas = NULL;
+    g->map = NULL;
+    g->map_len = 0;
+
+    // 2. Alloue le tableau des offsets (n+1 entrées, toutes à 0 : aucune arête)
+    g->offsets = calloc((size_t)n + 1, sizeof(int64_t));
 
     //* Si erreur d'allocation
-    if (!g->array) {
-        perror("malloc");
+    if (!g->offsets) {
+        perror("calloc");
         exit(EXIT_FAILURE);
     }
-    
-    // 3. Initialise chaque élément du tableau (chaque liste d'adjacence)
-    for (int i = 0; i < n; i++) {
-        list_init(&g->array[i]); // Utilise la fonction d'initialisation de list.c
-    }
 }
 
 /**
@@ -33,33 +39,114 @@ void graph_init(AdjList *g, int n){
  * @param g      Graph qui va être libéré (Pointeur vers AdjList)
  */
 void graph_free(AdjList *g){
-    
-    // 1. Libère la mémoire de toutes les listes d'adjacence (les arêtes)
-    for (int i = 0; i < g->size; i++) {
-        list_free(&g->array[i]); // Utilise la fonction de libération de list.c
+    if (g->map) {
+        // Tableaux portés par la projection du fichier binaire : une seule libération
+#ifndef _WIN32
+        munmap(g->map, g->map_len);
+#endif
+    } else {
+        free(g->offsets);
+        free(g->dests);
+        free(g->probas);
+    }
+    g->offsets = NULL;
+    g->dests = NULL;
+    g->probas = NULL;
+    g->map = NULL;
+    g->map_len = 0;
+    g->nnz = 0;
+    g->cap = 0;
+}
+
+/**
+ * @brief  Recopie en mémoire propre les tableaux d'un graphe projeté
+ *
+ * Un graphe chargé depuis un .mgb pointe dans une projection en lecture
+ * seule ; il faut le détacher avant toute modification.
+ *
+ * @param g  Graphe à détacher (sans effet s'il n'est pas projeté)
+ */
+static void graph_detach(AdjList *g) {
+    if (!g->map) return;
+
+    int64_t *offsets = malloc(((size_t)g->size + 1) * sizeof(int64_t));
+    int     *dests = malloc((size_t)(g->nnz > 0 ? g->nnz : 1) * sizeof(int));
+    float   *probas = malloc((size_t)(g->nnz > 0 ? g->nnz : 1) * sizeof(float));
+    if (!offsets || !dests || !probas) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
     }
-    
-    // 2. Libère la mémoire du tableau lui-même (qui contenait les pointeurs vers les listes)
-    free(g->array);
+    memcpy(offsets, g->offsets, ((size_t)g->size + 1) * sizeof(int64_t));
+    memcpy(dests, g->dests, (size_t)g->nnz * sizeof(int));
+    memcpy(probas, g->probas, (size_t)g->nnz * sizeof(float));
+
+#ifndef _WIN32
+    munmap(g->map, g->map_len);
+#endif
+    g->map = NULL;
+    g->map_len = 0;
+    g->offsets = offsets;
+    g->dests = dests;
+    g->probas = probas;
+    g->cap = g->nnz > 0 ? g->nnz : 1;
+}
+
+/**
+ * @brief        Réserve la place pour au moins nnz arêtes
+ * @param g      Graphe à agrandir
+ * @param nnz    Nombre total d'arêtes à pouvoir stocker
+ */
+void graph_reserve(AdjList *g, int64_t nnz) {
+    graph_detach(g);
+    if (nnz <= g->cap) return;
+
+    int *dests = realloc(g->dests, (size_t)nnz * sizeof(int));
+    float *probas = realloc(g->probas, (size_t)nnz * sizeof(float));
+    if (!dests || !probas) {
+        perror("realloc");
+        exit(EXIT_FAILURE);
+    }
+    g->dests = dests;
+    g->probas = probas;
+    g->cap = nnz;
 }
 
 /**
  * @brief       Ajoute une arête orientée dans un graphe de Markov
+ *
+ * L'arête est placée en tête des sorties de `from` (même ordre de parcours
+ * que l'ancien empilement en tête de liste). L'insertion décale les arêtes
+ * suivantes : coût O(nnz), réservé à la construction de petits graphes.
+ * Les chargeurs remplissent directement les tableaux en deux passes.
+ *
  * @param g     Pointeur vers le graphe à modifier
  * @param from  Sommet de départ de l'arête (doit être entre 1 et g->size)
  * @param to    Sommet d'arrivée de l'arête (doit être entre 1 et g->size)
  * @param proba Probabilité de transition associée à l'arête
  */
 void graph_add_edge(AdjList *g, int from, int to, float proba) {
-    // Important : vérification des indices, à partir de 1 dans l'interface, mais 0 dans le tableau g->array
+    // Important : vérification des indices, à partir de 1 dans l'interface, mais 0 dans les tableaux
     if ((from < 1 || from > g->size) || (to < 1 || to > g->size)) {
         fprintf(stderr, "indices invalides\n");
         exit(EXIT_FAILURE);
     }
-    
-    // Ajout de l'arête dans la liste d'adjacence du sommet de départ 'from'
-    // L'arête est ajoutée au début (list_push_front)
-    list_push_front(&g->array[from - 1], to, proba); // -1 car indices commence à partir de 1 pour l'utilisateur
+
+    // Croissance géométrique de la capacité
+    if (g->map || g->nnz >= g->cap) {
+        graph_reserve(g, g->cap > 0 ? g->cap * 2 : 16);
+    }
+
+    // Décale les arêtes des sommets suivants d'une case
+    int64_t pos = g->offsets[from - 1];
+    size_t tail = (size_t)(g->nnz - pos);
+    memmove(&g->dests[pos + 1], &g->dests[pos], tail * sizeof(int));
+    memmove(&g->probas[pos + 1], &g->probas[pos], tail * sizeof(float));
+    g->dests[pos] = to;
+    g->probas[pos] = proba;
+    for (int i = from; i <= g->size; ++i) {
+        g->offsets[i]++;
+    }
+    g->nnz++;
 }
 
 /**
@@ -72,8 +159,10 @@ void graph_print(const AdjList *g) {
     for (int i = 0; i < g->size; i++) {
         // Affiche l'indice du sommet (i + 1 pour l'affichage à partir de 1)
         printf("Sommet %d: ", i + 1);
-        
-        // Affiche la liste d'adjacence (transitions sortantes) pour ce sommet
-        list_print(g->array[i]);
+
+        // Affiche les transitions sortantes (Destination, Probabilité) de ce sommet
+        for (int64_t k = g->offsets[i]; k < g->offsets[i + 1]; ++k) {
+            printf("(%d, %f)", g->dests[k], g->probas[k]);
+        }
     }
-}
\ No newline at end of file
+}
@@ -1,5 +1,6 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
 #include "hasse.h"
 #include "graph.h"
 #include "scc.h"
@@ -13,6 +14,8 @@ void hasse_init_links(HasseLinkArray *arr){
     arr->links = NULL;
     arr->count = 0; // Nombre de liens actuellement stockés
     arr->capacity = 0; // Capacité totale allouée
+    arr->weighted = 0; // Pas encore d'agrégats (proba, edges)
+    arr->has_flow = 0;
 }
 
 /**
@@ -49,130 +52,515 @@ int hasse_link_exists(const HasseLinkArray *arr, int c_from, int c_to){
 /**
  * @brief Construit une table de correspondance pour trouver rapidement la classe d'appartenance de n'importe quel sommet.
  *
+ * Recopie `p->class_of` (rempli à la construction de la partition).
+ *
  * @param p Partition contenant les classes de composantes fortement connexes (SCC).
  * @param n_vertices Nombre total de sommets dans le graphe original.
  * @param class_of_vertex Tableau de sortie (taille n_vertices + 1) où l'indice est le sommet et la valeur est l'indice de sa classe (à partir de 0).
  */
 void build_vertex_to_class_map(Partition *p, int n_vertices, int *class_of_vertex){
     if (!p || !class_of_vertex) return;
-    // initialiser à -1 pour détecter les sommets non affectés
     for (int v = 0; v <= n_vertices; ++v) {
-        class_of_vertex[v] = -1;
-    }
-    // Parcourt chaque classe (i est l'indice de la classe, 0-basé)
-    for(int i =0; i<p->count;i++){
-        SccClass v = p->classes[i]; // La classe actuelle
-        
-        // Parcourt chaque sommet 'k' dans cette classe
-        for (int j = 0; j<v.count; j++) {
-            int k = v.verts[j];
-            
-            // Vérifie que l'indice du sommet est valide
-            if (k >= 1 && k <= n_vertices) {
-                // Stocke l'indice de la classe (i) à la position du sommet (k)
-                class_of_vertex[k] = i; // k (sommet 1-basé) -> i (classe 0-basée)
+        // -1 pour les sommets non affectés
+        class_of_vertex[v] = v < p->class_of_len ? p->class_of[v] : -1;
+    }
+}
+
+/**
+ * @brief Alloue un bloc mémoire avec vérification stricte (arrêt du programme en cas d'échec).
+ *
+ * @param sz Taille en octets.
+ * @return Pointeur alloué (non NULL si sz > 0).
+ */
+static void *xmalloc(size_t sz) {
+    void *q = malloc(sz);
+    if (!q && sz != 0) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    return q;
+}
+
+/**
+ * @brief Ordre topologique du graphe de condensation (algorithme de Kahn).
+ *
+ * Utilisé quand les classes ne sont pas rangées dans l'ordre de sortie de
+ * Tarjan (partition parallèle, partition construite à la main).
+ *
+ * @param c Graphe de condensation (c->topo rempli).
+ */
+static void topo_kahn(t_condensation *c) {
+    int *indeg = calloc((size_t)c->n, sizeof(int));
+    if (!indeg && c->n > 0) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int64_t k = 0; k < c->nnz; ++k) indeg[c->succ[k]]++;
+
+    // c->topo sert de file : on lit en 'head', on écrit en 'tail'
+    int head = 0, tail = 0;
+    for (int i = 0; i < c->n; ++i) {
+        if (indeg[i] == 0) c->topo[tail++] = i;
+    }
+    while (head < tail) {
+        int i = c->topo[head++];
+        for (int64_t k = c->offsets[i]; k < c->offsets[i + 1]; ++k) {
+            if (--indeg[c->succ[k]] == 0) c->topo[tail++] = c->succ[k];
+        }
+    }
+    free(indeg);
+}
+
+// Agrandit les tableaux de liens du graphe de condensation (capacité doublée)
+static void condensation_grow(t_condensation *out, int64_t *cap) {
+    *cap = *cap > 0 ? *cap * 2 : 16;
+    int *ns = realloc(out->succ, (size_t)*cap * sizeof(int));
+    double *np = realloc(out->proba, (size_t)*cap * sizeof(double));
+    int64_t *ne = realloc(out->edges, (size_t)*cap * sizeof(int64_t));
+    if (ns) out->succ = ns;
+    if (np) out->proba = np;
+    if (ne) out->edges = ne;
+    if (!ns || !np || !ne) {
+        perror("realloc");
+        exit(EXIT_FAILURE);
+    }
+    if (out->flow) {
+        double *nf = realloc(out->flow, (size_t)*cap * sizeof(double));
+        if (!nf) {
+            perror("realloc");
+            exit(EXIT_FAILURE);
+        }
+        out->flow = nf;
+    }
+}
+
+/**
+ * @brief Construit le graphe de condensation (liens entre classes, sans doublon) en une passe.
+ *
+ * Équivalent à build_condensation_weighted sans poids de sommets (flow == NULL).
+ *
+ * @param g Pointeur vers le graphe d'adjacence original.
+ * @param p Pointeur vers la partition des classes (SCC).
+ * @param out Graphe de condensation à remplir (à libérer via condensation_free).
+ */
+void build_condensation(const AdjList *g, const Partition *p, t_condensation *out) {
+    build_condensation_weighted(g, p, NULL, out);
+}
+
+/**
+ * @brief Construit le graphe de condensation pondéré (liens sans doublon et agrégats) en une passe.
+ *
+ * Chaque classe parcourt les arêtes sortantes de ses sommets ; slot[d] garde
+ * la position du lien vers la classe d : il appartient à la classe courante
+ * s'il est >= offsets[c], ce qui élimine les doublons en O(1) et permet
+ * d'agréger sur place, pour chaque lien, la somme des probabilités, le
+ * nombre d'arcs et, si vertex_weight est fourni, le flux
+ * somme(vertex_weight[v-1] * p(v -> w)). Coût total O(N + M).
+ *
+ * Tarjan produit les classes en ordre topologique inverse (tout successeur
+ * d'une classe a un indice plus petit) : l'ordre topologique s'en déduit sans
+ * calcul. Sinon (partition dans un autre ordre), il est calculé par Kahn.
+ *
+ * @param g Pointeur vers le graphe d'adjacence original.
+ * @param p Pointeur vers la partition des classes (SCC).
+ * @param vertex_weight Poids des sommets (taille g->size, ex. distribution stationnaire) ou NULL.
+ * @param out Graphe de condensation à remplir (à libérer via condensation_free).
+ */
+void build_condensation_weighted(const AdjList *g, const Partition *p, const float *vertex_weight,
+                                 t_condensation *out) {
+    int nc = p->count;
+    out->n = nc;
+    out->offsets = xmalloc(((size_t)nc + 1) * sizeof(int64_t));
+    out->topo = xmalloc((size_t)(nc > 0 ? nc : 1) * sizeof(int));
+    out->succ = NULL;
+    out->proba = NULL;
+    out->edges = NULL;
+    out->flow = vertex_weight ? xmalloc(sizeof(double)) : NULL;
+    out->nnz = 0;
+
+    int64_t cap = 0;
+    int64_t *slot = xmalloc((size_t)(nc > 0 ? nc : 1) * sizeof(int64_t));
+    for (int c = 0; c < nc; ++c) slot[c] = -1;
+
+    int reverse_topo = 1; // classes dans l'ordre de sortie de Tarjan ?
+    for (int c = 0; c < nc; ++c) {
+        int64_t first = out->nnz;
+        out->offsets[c] = first;
+        SccClass cls = scc_class(p, c);
+        for (int j = 0; j < cls.count; ++j) {
+            int v = cls.verts[j];
+            if (v < 1 || v > g->size) continue;
+            for (int64_t k = g->offsets[v - 1]; k < g->offsets[v]; ++k) {
+                int w = g->dests[k];
+                int d = w < p->class_of_len ? p->class_of[w] : -1;
+                if (d < 0 || d == c) continue;
+
+                int64_t s = slot[d];
+                if (s < first) {
+                    // Premier arc de c vers d : nouveau lien
+                    if (d > c) reverse_topo = 0;
+                    if (out->nnz == cap) condensation_grow(out, &cap);
+                    s = out->nnz++;
+                    slot[d] = s;
+                    out->succ[s] = d;
+                    out->proba[s] = 0.0;
+                    out->edges[s] = 0;
+                    if (out->flow) out->flow[s] = 0.0;
+                }
+                out->proba[s] += (double)g->probas[k];
+                out->edges[s]++;
+                if (out->flow) out->flow[s] += (double)vertex_weight[v - 1] * (double)g->probas[k];
             }
         }
     }
+    out->offsets[nc] = out->nnz;
+    free(slot);
+
+    if (reverse_topo) {
+        for (int i = 0; i < nc; ++i) out->topo[i] = nc - 1 - i;
+    } else {
+        topo_kahn(out);
+    }
+}
+
+/**
+ * @brief Libère le graphe de condensation et le remet à zéro.
+ *
+ * @param c Graphe de condensation à libérer.
+ */
+void condensation_free(t_condensation *c) {
+    if (!c) return;
+    free(c->offsets);
+    free(c->succ);
+    free(c->topo);
+    free(c->proba);
+    free(c->edges);
+    free(c->flow);
+    c->offsets = NULL;
+    c->succ = NULL;
+    c->topo = NULL;
+    c->proba = NULL;
+    c->edges = NULL;
+    c->flow = NULL;
+    c->n = 0;
+    c->nnz = 0;
 }
 
 /**
  * @brief Détecte les liens directs entre les différentes classes d'équivalence CFC à partir du graphe original.
  *
+ * Liens du graphe de condensation, rangés par classe de départ, avec leurs
+ * agrégats (probabilité totale, nombre d'arcs). Voir build_class_links_weighted.
+ *
  * @param g Pointeur vers le graphe d'adjacence original.
  * @param p Pointeur vers la partition des classes (SCC).
  * @param out_links Pointeur vers le tableau de liens de Hasse à construire (croissance dynamique).
  */
 void build_class_links(const AdjList *g, const Partition *p, HasseLinkArray *out_links) {
-    // Allocation du tableau pour la table de correspondance (n_vertices + 1 pour l'indexation 1-basée)
-    int *class_of_vertex = malloc((g->size + 1) * sizeof(int));
-    // Remplissage de la table de correspondance
-    build_vertex_to_class_map((Partition *)p, g->size, class_of_vertex);
-
-    // 1. Parcourt tous les sommets du graphe original (v est 1-basé)
-    for (int v = 1; v <= g->size; v++) {
-        // 2. Parcourt toutes les arêtes sortantes du sommet v (v-1 pour tableau 0-basé)
-        for (Cell *adj = g->array[v - 1].head; adj != NULL; adj = adj->next) {
-            
-            // Détermine la classe de départ et d'arrivée
-            int from_class = class_of_vertex[v];
-            int to_class = class_of_vertex[adj->dest];
-            
-            // 3. Vérifie si le lien est inter-classes et n'existe pas déjà
-            if (from_class != to_class && !hasse_link_exists(out_links, from_class + 1, to_class + 1)) {
-                
-                // Gestion de la croissance dynamique du tableau de liens (doublage de la capacité)
-                if (out_links->count == out_links->capacity) {
-                    out_links->capacity = out_links->capacity == 0 ? 4 : out_links->capacity * 2;
-                    out_links->links = realloc(out_links->links, out_links->capacity * sizeof(HasseLink));
-                }
-                
-                // 4. Ajout du nouveau lien
-                out_links->links[out_links->count].from_class = from_class; // 0-basé
-                out_links->links[out_links->count].to_class = to_class;     // 0-basé
-                out_links->count++;
-            }
+    build_class_links_weighted(g, p, NULL, out_links);
+}
+
+/**
+ * @brief Liens entre classes avec agrégats, et flux si des poids de sommets sont fournis.
+ *
+ * @param g Pointeur vers le graphe d'adjacence original.
+ * @param p Pointeur vers la partition des classes (SCC).
+ * @param vertex_weight Poids des sommets (taille g->size) ou NULL (pas de flux).
+ * @param out_links Tableau de liens complété (weighted = 1, has_flow selon vertex_weight).
+ */
+void build_class_links_weighted(const AdjList *g, const Partition *p, const float *vertex_weight,
+                                HasseLinkArray *out_links) {
+    t_condensation C;
+    build_condensation_weighted(g, p, vertex_weight, &C);
+
+    // Réserve d'un coup la place de tous les liens
+    int need = out_links->count + (int)C.nnz;
+    if (need > out_links->capacity) {
+        HasseLink *nl = realloc(out_links->links, (size_t)need * sizeof(HasseLink));
+        if (!nl) {
+            perror("realloc");
+            exit(EXIT_FAILURE);
         }
+        out_links->links = nl;
+        out_links->capacity = need;
     }
+    for (int c = 0; c < C.n; ++c) {
+        for (int64_t k = C.offsets[c]; k < C.offsets[c + 1]; ++k) {
+            HasseLink *l = &out_links->links[out_links->count++];
+            l->from_class = c;          // 0-basé
+            l->to_class = C.succ[k];    // 0-basé
+            l->proba = C.proba[k];
+            l->edges = C.edges[k];
+            l->flow = C.flow ? C.flow[k] : 0.0;
+        }
+    }
+    out_links->weighted = 1;
+    out_links->has_flow = C.flow != NULL;
 
-    free(class_of_vertex); // Libère la table de correspondance temporaire
+    condensation_free(&C);
 }
 
 
+// Taille maximale des bitsets d'accessibilité (C x C bits) ; au-delà,
+// remove_transitive_links passe au parcours par classe (mémoire O(C + L))
+#define HASSE_BITSET_MAX_BYTES ((size_t)1 << 30)
+
+// Liens rangés par classe de départ : link_idx[offsets[c] .. offsets[c+1]-1]
+typedef struct {
+    int *offsets;   // [nb_classes+1]
+    int *link_idx;  // indices dans links->links
+    int *topo;      // [nb_classes] ordre topologique
+    int  topo_len;  // < nb_classes si les liens forment un cycle
+} t_link_csr;
+
 /**
- * @brief Supprime les liens redondants pour obtenir le diagramme de Hasse (les liens transitifs : A->C si A->B et B->C existent).
+ * @brief Range les liens par classe de départ et calcule un ordre topologique (Kahn).
  *
- * @param links Pointeur vers le tableau de liens entre classes à modifier.
- * @param nb_classes Nombre total de classes.
+ * @param links Liens entre classes (0-basés).
+ * @param nb_classes Nombre de classes.
+ * @param out Structure remplie (à libérer via link_csr_free).
  */
-void remove_transitive_links(HasseLinkArray *links, int nb_classes){
-    // 1. Allocation d'une matrice d'accessibilité (matrice booléenne carrée de taille nb_classes x nb_classes)
-    int **reach = malloc(nb_classes * sizeof(int *));
-    for (int i = 0; i < nb_classes; i++) {
-        reach[i] = calloc(nb_classes, sizeof(int)); // calloc initialise à 0
+static void link_csr_build(const HasseLinkArray *links, int nb_classes, t_link_csr *out) {
+    int n = nb_classes;
+    out->offsets = calloc((size_t)n + 1, sizeof(int));
+    out->link_idx = xmalloc((size_t)(links->count > 0 ? links->count : 1) * sizeof(int));
+    out->topo = xmalloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    int *indeg = calloc((size_t)n + 1, sizeof(int));
+    if (!out->offsets || !indeg) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
     }
 
-    // 2. Remplissage initial de la matrice d'accessibilité avec les liens directs
+    for (int i = 0; i < links->count; ++i) {
+        out->offsets[links->links[i].from_class + 1]++;
+        indeg[links->links[i].to_class]++;
+    }
+    for (int c = 0; c < n; ++c) out->offsets[c + 1] += out->offsets[c];
+    int *cursor = xmalloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    for (int c = 0; c < n; ++c) cursor[c] = out->offsets[c];
+    for (int i = 0; i < links->count; ++i) {
+        out->link_idx[cursor[links->links[i].from_class]++] = i;
+    }
+    free(cursor);
+
+    // out->topo sert de file : on lit en 'head', on écrit en 'tail'
+    int head = 0, tail = 0;
+    for (int c = 0; c < n; ++c) {
+        if (indeg[c] == 0) out->topo[tail++] = c;
+    }
+    while (head < tail) {
+        int c = out->topo[head++];
+        for (int k = out->offsets[c]; k < out->offsets[c + 1]; ++k) {
+            int d = links->links[out->link_idx[k]].to_class;
+            if (--indeg[d] == 0) out->topo[tail++] = d;
+        }
+    }
+    out->topo_len = tail;
+    free(indeg);
+}
+
+static void link_csr_free(t_link_csr *L) {
+    free(L->offsets);
+    free(L->link_idx);
+    free(L->topo);
+}
+
+// Garde les liens marqués (ordre d'origine conservé)
+static void compact_links(HasseLinkArray *links, const unsigned char *keep) {
+    int write_idx = 0;
     for (int i = 0; i < links->count; i++) {
-        reach[links->links[i].from_class][links->links[i].to_class] = 1;
+        if (keep[i]) links->links[write_idx++] = links->links[i];
+    }
+    links->count = write_idx;
+}
+
+/**
+ * @brief Réduction transitive d'un DAG par bitsets d'accessibilité.
+ *
+ * Classes traitées en ordre topologique inverse : reach[c] (C bits) = classes
+ * atteignables depuis c par un chemin non vide. Le lien c -> d est transitif
+ * si d est atteignable depuis un successeur de c, c'est-à-dire si d appartient
+ * à l'union M des reach[e] pour les successeurs e de c ; ensuite
+ * reach[c] = M + successeurs. Coût O(L * C / 64) opérations sur des mots.
+ */
+static void reduce_dag_bitset(HasseLinkArray *links, int nb_classes, const t_link_csr *L,
+                              unsigned char *keep) {
+    size_t nw = ((size_t)nb_classes + 63) / 64;
+    uint64_t *reach = calloc((size_t)nb_classes * nw, sizeof(uint64_t));
+    if (!reach) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int t = nb_classes - 1; t >= 0; --t) {
+        int c = L->topo[t];
+        uint64_t *rc = reach + (size_t)c * nw;
+        // rc <- M : union des accessibilités des successeurs
+        for (int k = L->offsets[c]; k < L->offsets[c + 1]; ++k) {
+            const uint64_t *re = reach + (size_t)links->links[L->link_idx[k]].to_class * nw;
+            for (size_t w = 0; w < nw; ++w) rc[w] |= re[w];
+        }
+        for (int k = L->offsets[c]; k < L->offsets[c + 1]; ++k) {
+            int i = L->link_idx[k];
+            int d = links->links[i].to_class;
+            keep[i] = !((rc[d >> 6] >> (d & 63)) & 1u);
+        }
+        for (int k = L->offsets[c]; k < L->offsets[c + 1]; ++k) {
+            int d = links->links[L->link_idx[k]].to_class;
+            rc[d >> 6] |= (uint64_t)1 << (d & 63);
+        }
     }
+    free(reach);
+}
+
+/**
+ * @brief Réduction transitive d'un DAG par un parcours depuis chaque classe.
+ *
+ * Pour chaque classe c, marque (stamp = c) tout ce qui est atteignable depuis
+ * les successeurs de c par un chemin non vide ; le lien c -> d est transitif
+ * si d est marqué. Mémoire O(C + L), temps O(C * L) au pire.
+ */
+static void reduce_dag_dfs(HasseLinkArray *links, int nb_classes, const t_link_csr *L,
+                           unsigned char *keep) {
+    int *stamp = xmalloc((size_t)(nb_classes > 0 ? nb_classes : 1) * sizeof(int));
+    int *stack = xmalloc((size_t)(nb_classes > 0 ? nb_classes : 1) * sizeof(int));
+    for (int c = 0; c < nb_classes; ++c) stamp[c] = -1;
 
-    // 3. Calcul de la fermeture transitive (Algorithme de Floyd-Warshall)
-    // Après cette étape, reach[i][j] = 1 si la classe i peut atteindre la classe j
-    for (int k = 0; k < nb_classes; k++) { // Classe intermédiaire
-        for (int i = 0; i < nb_classes; i++) { // Classe de départ
-            for (int j = 0; j < nb_classes; j++) { // Classe d'arrivée
-                // Si i peut atteindre k, et k peut atteindre j, alors i peut atteindre j
-                if (reach[i][k] && reach[k][j]) reach[i][j] = 1;
+    for (int c = 0; c < nb_classes; ++c) {
+        int sp = 0;
+        for (int k = L->offsets[c]; k < L->offsets[c + 1]; ++k) {
+            int e = links->links[L->link_idx[k]].to_class;
+            for (int q = L->offsets[e]; q < L->offsets[e + 1]; ++q) {
+                int f = links->links[L->link_idx[q]].to_class;
+                if (stamp[f] != c) {
+                    stamp[f] = c;
+                    stack[sp++] = f;
+                }
             }
+            while (sp > 0) {
+                int v = stack[--sp];
+                for (int q = L->offsets[v]; q < L->offsets[v + 1]; ++q) {
+                    int f = links->links[L->link_idx[q]].to_class;
+                    if (stamp[f] != c) {
+                        stamp[f] = c;
+                        stack[sp++] = f;
+                    }
+                }
+            }
+        }
+        for (int k = L->offsets[c]; k < L->offsets[c + 1]; ++k) {
+            int i = L->link_idx[k];
+            keep[i] = stamp[links->links[i].to_class] != c;
         }
     }
+    free(stamp);
+    free(stack);
+}
 
-    // 4. Filtrage : on ne garde que les liens qui ne sont pas transitifs
-    int write_idx = 0; // Index pour écrire dans le tableau compacté
+/**
+ * @brief Réduction transitive de liens quelconques (cycles permis) : Warshall sur bitsets.
+ *
+ * Fermeture transitive ligne par ligne (si i atteint k, reach[i] |= reach[k]),
+ * puis même filtre que la version d'origine : from -> to est transitif s'il
+ * existe k != from, to avec from -> ... -> k -> ... -> to.
+ * Les liens issus de build_class_links forment un DAG : ce cas ne sert que
+ * pour des tableaux de liens construits à la main.
+ */
+static void reduce_general(HasseLinkArray *links, int nb_classes, unsigned char *keep) {
+    size_t nw = ((size_t)nb_classes + 63) / 64;
+    uint64_t *reach = calloc((size_t)nb_classes * nw, sizeof(uint64_t));
+    if (!reach) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < links->count; i++) {
+        int a = links->links[i].from_class, b = links->links[i].to_class;
+        reach[(size_t)a * nw + (b >> 6)] |= (uint64_t)1 << (b & 63);
+    }
+    for (int k = 0; k < nb_classes; k++) {
+        const uint64_t *rk = reach + (size_t)k * nw;
+        for (int i = 0; i < nb_classes; i++) {
+            uint64_t *ri = reach + (size_t)i * nw;
+            if ((ri[k >> 6] >> (k & 63)) & 1u) {
+                for (size_t w = 0; w < nw; ++w) ri[w] |= rk[w];
+            }
+        }
+    }
+
+    // Colonne 'to' lue bit à bit : reach[k][to]
     for (int i = 0; i < links->count; i++) {
         int from = links->links[i].from_class;
         int to = links->links[i].to_class;
-        int transitive = 0;
-        
-        // Recherche d'un chemin intermédiaire k tel que from -> k -> to
+        const uint64_t *rf = reach + (size_t)from * nw;
+        keep[i] = 1;
         for (int k = 0; k < nb_classes; k++) {
-            // k doit être différent de from et to
-            if (k != from && k != to && reach[from][k] && reach[k][to]) {
-                transitive = 1; // Lien transitif trouvé (A->B->C, donc A->C est redondant)
+            if (k != from && k != to && ((rf[k >> 6] >> (k & 63)) & 1u)
+                && ((reach[(size_t)k * nw + (to >> 6)] >> (to & 63)) & 1u)) {
+                keep[i] = 0;
                 break;
             }
         }
-        
-        // Si le lien n'est pas transitif (il fait partie du graphe minimal)
-        if (!transitive) {
-            links->links[write_idx++] = links->links[i]; // Garde le lien
-        }
     }
-    // Mise à jour du nombre de liens après le compactage
-    links->count = write_idx;
-
-    // 5. Libération de la matrice d'accessibilité
-    for (int i = 0; i < nb_classes; i++) free(reach[i]);
     free(reach);
 }
+
+/**
+ * @brief Supprime les liens redondants pour obtenir le diagramme de Hasse (les liens transitifs : A->C si A->B et B->C existent).
+ *
+ * Les liens forment normalement un DAG (graphe de condensation) : traitement
+ * en ordre topologique avec des bitsets d'accessibilité (C x C bits), ou par
+ * un parcours depuis chaque classe si ces bitsets dépassent
+ * HASSE_BITSET_MAX_BYTES. Un tableau de liens avec cycle est réduit par
+ * Warshall sur bitsets. Même ensemble de liens conservés que la fermeture
+ * de Floyd-Warshall d'origine, dans le même ordre.
+ *
+ * @param links Pointeur vers le tableau de liens entre classes à modifier.
+ * @param nb_classes Nombre total de classes.
+ */
+void remove_transitive_links(HasseLinkArray *links, int nb_classes){
+    if (!links || links->count == 0 || nb_classes <= 0) return;
+
+    unsigned char *keep = xmalloc((size_t)links->count);
+    t_link_csr L;
+    link_csr_build(links, nb_classes, &L);
+    size_t bitset_bytes = (size_t)nb_classes * (((size_t)nb_classes + 63) / 64) * sizeof(uint64_t);
+
+    if (L.topo_len < nb_classes) {
+        reduce_general(links, nb_classes, keep);
+    } else if (bitset_bytes <= HASSE_BITSET_MAX_BYTES) {
+        reduce_dag_bitset(links, nb_classes, &L, keep);
+    } else {
+        reduce_dag_dfs(links, nb_classes, &L, keep);
+    }
+    compact_links(links, keep);
+
+    link_csr_free(&L);
+    free(keep);
+}
+
+/**
+ * @brief Variante de remove_transitive_links à mémoire O(C + L), sans bitset.
+ *
+ * Parcours depuis chaque classe : choisie automatiquement pour les très
+ * grands C, exposée pour les tests et benchmarks. Les liens doivent former
+ * un DAG (sinon, bascule sur la version générale).
+ *
+ * @param links Pointeur vers le tableau de liens entre classes à modifier.
+ * @param nb_classes Nombre total de classes.
+ */
+void remove_transitive_links_lowmem(HasseLinkArray *links, int nb_classes){
+    if (!links || links->count == 0 || nb_classes <= 0) return;
+
+    unsigned char *keep = xmalloc((size_t)links->count);
+    t_link_csr L;
+    link_csr_build(links, nb_classes, &L);
+    if (L.topo_len < nb_classes) {
+        reduce_general(links, nb_classes, keep);
+    } else {
+        reduce_dag_dfs(links, nb_classes, &L, keep);
+    }
+    compact_links(links, keep);
+
+    link_csr_free(&L);
+    free(keep);
+}
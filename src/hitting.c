@@ -0,0 +1,238 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hitting.h"
+#include "hasse.h"
+
+/*
+ * Temps moyens d'atteinte d'un ensemble cible T. Seuls les sommets qui
+ * atteignent T presque sûrement ont un temps fini ; on les isole avant de
+ * résoudre :
+ *  1. Une classe atteint T si elle contient une cible ou si un de ses
+ *     successeurs l'atteint (programmation dynamique sur le graphe de
+ *     condensation, des puits vers les sources). Les sommets des autres
+ *     classes sont écartés sans rien résoudre.
+ *  2. Un sommet restant qui peut, sans passer par T, entrer dans un sommet
+ *     écarté ne touche T qu'avec une probabilité < 1 : parcours arrière
+ *     depuis ces sommets, sur les seuls arcs entre sommets restants.
+ *  3. Les sommets finis vérifient (I - Q) h = 1, Q restreinte aux sommets
+ *     finis (les arcs vers T valent h = 0), résolu par BiCGSTAB redémarré.
+ *     Le rayon spectral de Q est proche de 1 dès que T est petit (temps
+ *     d'atteinte de l'ordre de n / |T|) : Gauss-Seidel demanderait des
+ *     dizaines de milliers de balayages là où BiCGSTAB converge en
+ *     quelques dizaines d'itérations. Gauss-Seidel sert de repli ; les
+ *     lignes sont rangées classe par classe des puits vers les sources,
+ *     pour qu'un balayage trouve les classes en aval déjà mises à jour.
+ */
+
+// Itérations de BiCGSTAB entre deux redémarrages
+#define HIT_RESTART 200
+
+static void *xmalloc(size_t sz) {
+    void *q = malloc(sz ? sz : 1);
+    if (!q) {
+        perror("malloc(hitting)");
+        exit(EXIT_FAILURE);
+    }
+    return q;
+}
+
+/**
+ * @brief  Étapes 1 et 2 : statut de chaque sommet
+ *
+ * @param[in]  g          Graphe
+ * @param[in]  p          Partition en classes
+ * @param[in]  cond       Graphe de condensation de p
+ * @param[in]  is_target  [size+1] 1 si le sommet est une cible
+ * @param[out] status     [size+1] statut de chaque sommet
+ *
+ * @return  Nombre de sommets HIT_FINITE
+ */
+static int classify_vertices(const AdjList *g, const Partition *p, const t_condensation *cond,
+                             const unsigned char *is_target, unsigned char *status) {
+    int n = g->size;
+    int nc = p->count;
+
+    unsigned char *reach = xmalloc((size_t)nc);
+    memset(reach, 0, (size_t)nc);
+    for (int v = 1; v <= n; ++v) {
+        if (is_target[v]) reach[p->class_of[v]] = 1;
+    }
+    for (int r = nc - 1; r >= 0; --r) {
+        int k = cond->topo[r];
+        for (int64_t e = cond->offsets[k]; e < cond->offsets[k + 1] && !reach[k]; ++e) {
+            reach[k] = reach[cond->succ[e]];
+        }
+    }
+
+    for (int v = 1; v <= n; ++v) {
+        if (is_target[v]) {
+            status[v] = HIT_TARGET;
+        } else {
+            status[v] = reach[p->class_of[v]] ? HIT_FINITE : HIT_UNREACHABLE;
+        }
+    }
+    free(reach);
+
+    // Sommets restants ayant un arc vers un sommet écarté
+    int *queue = xmalloc((size_t)n * sizeof(int));
+    int qh = 0, qt = 0;
+    for (int v = 1; v <= n; ++v) {
+        if (status[v] != HIT_FINITE) continue;
+        for (int64_t e = g->offsets[v - 1]; e < g->offsets[v]; ++e) {
+            if (status[g->dests[e]] == HIT_UNREACHABLE) {
+                status[v] = HIT_ESCAPE;
+                queue[qt++] = v;
+                break;
+            }
+        }
+    }
+
+    if (qt > 0) {
+        // Arcs inverses entre sommets restants (non cibles), au format CSR
+        int64_t *rptr = xmalloc(((size_t)n + 2) * sizeof(int64_t));
+        memset(rptr, 0, ((size_t)n + 2) * sizeof(int64_t));
+        for (int v = 1; v <= n; ++v) {
+            if (status[v] == HIT_TARGET || status[v] == HIT_UNREACHABLE) continue;
+            for (int64_t e = g->offsets[v - 1]; e < g->offsets[v]; ++e) {
+                int w = g->dests[e];
+                if (status[w] == HIT_FINITE || status[w] == HIT_ESCAPE) rptr[w + 1]++;
+            }
+        }
+        for (int v = 1; v <= n; ++v) rptr[v + 1] += rptr[v];
+        int *rsrc = xmalloc((size_t)rptr[n + 1] * sizeof(int));
+        int64_t *fill = xmalloc(((size_t)n + 1) * sizeof(int64_t));
+        memcpy(fill, rptr, ((size_t)n + 1) * sizeof(int64_t));
+        for (int v = 1; v <= n; ++v) {
+            if (status[v] == HIT_TARGET || status[v] == HIT_UNREACHABLE) continue;
+            for (int64_t e = g->offsets[v - 1]; e < g->offsets[v]; ++e) {
+                int w = g->dests[e];
+                if (status[w] == HIT_FINITE || status[w] == HIT_ESCAPE) rsrc[fill[w]++] = v;
+            }
+        }
+        free(fill);
+
+        while (qh < qt) {
+            int w = queue[qh++];
+            for (int64_t e = rptr[w]; e < rptr[w + 1]; ++e) {
+                int v = rsrc[e];
+                if (status[v] == HIT_FINITE) {
+                    status[v] = HIT_ESCAPE;
+                    queue[qt++] = v;
+                }
+            }
+        }
+        free(rsrc);
+        free(rptr);
+    }
+    free(queue);
+
+    int finite = 0;
+    for (int v = 1; v <= n; ++v) finite += (status[v] == HIT_FINITE);
+    return finite;
+}
+
+/**
+ * @brief  Temps moyens d'atteinte de l'ensemble cible depuis chaque sommet
+ *
+ * Une seule résolution creuse donne le vecteur complet ; les sommets qui
+ * n'atteignent pas les cibles presque sûrement sont écartés avant (voir
+ * l'en-tête du fichier) et reçoivent h = -1.
+ *
+ * @param[in]  g          Graphe
+ * @param[in]  p          Partition en classes de g
+ * @param[in]  is_target  [size+1] 1 si le sommet est une cible
+ * @param[in]  tol        Tolérance relative (ex. HIT_TOL)
+ * @param[in]  max_iter   Itérations max (ex. HIT_MAX_ITER)
+ * @param[out] h          [size+1] temps moyen d'atteinte
+ * @param[out] status     [size+1] statut de chaque sommet (t_hit_status)
+ * @param[out] info       Bilan de la résolution (peut être NULL)
+ *
+ * @return  1 si convergé, 0 sinon, -1 si une somme sortante > 1 rend le
+ *          système singulier
+ */
+int hitting_times(const AdjList *g, const Partition *p, const unsigned char *is_target,
+                  double tol, int max_iter, double *h, unsigned char *status, t_solve_info *info) {
+    int n = g->size;
+    t_solve_info local;
+    if (!info) info = &local;
+    memset(info, 0, sizeof(*info));
+    info->converged = 1;
+
+    t_condensation cond;
+    build_condensation(g, p, &cond);
+    int m = classify_vertices(g, p, &cond, is_target, status);
+
+    for (int v = 0; v <= n; ++v) h[v] = (v > 0 && status[v] == HIT_TARGET) ? 0.0 : -1.0;
+    if (m == 0) {
+        condensation_free(&cond);
+        return 1;
+    }
+
+    // Lignes des sommets finis, classe par classe des puits vers les sources
+    int *row_of = xmalloc(((size_t)n + 1) * sizeof(int));
+    int *vert = xmalloc((size_t)m * sizeof(int));
+    int rows = 0;
+    for (int r = p->count - 1; r >= 0; --r) {
+        SccClass c = scc_class(p, cond.topo[r]);
+        for (int i = 0; i < c.count; ++i) {
+            int v = c.verts[i];
+            if (status[v] == HIT_FINITE) {
+                vert[rows] = v;
+                row_of[v] = rows++;
+            }
+        }
+    }
+    condensation_free(&cond);
+
+    int64_t nnz = 0;
+    for (int i = 0; i < m; ++i) {
+        int v = vert[i];
+        for (int64_t e = g->offsets[v - 1]; e < g->offsets[v]; ++e) {
+            nnz += (status[g->dests[e]] == HIT_FINITE);
+        }
+    }
+    t_spmatrix A;
+    A.n = m;
+    A.nnz = nnz;
+    A.row_ptr = xmalloc(((size_t)m + 1) * sizeof(int64_t));
+    A.col = xmalloc((size_t)nnz * sizeof(int));
+    A.val = xmalloc((size_t)nnz * sizeof(float));
+    int64_t pos = 0;
+    A.row_ptr[0] = 0;
+    for (int i = 0; i < m; ++i) {
+        int v = vert[i];
+        for (int64_t e = g->offsets[v - 1]; e < g->offsets[v]; ++e) {
+            int w = g->dests[e];
+            if (status[w] != HIT_FINITE) continue; // cible : h = 0
+            A.col[pos] = row_of[w];
+            A.val[pos] = g->probas[e];
+            pos++;
+        }
+        A.row_ptr[i + 1] = pos;
+    }
+
+    double *b = xmalloc((size_t)m * sizeof(double));
+    double *x = xmalloc((size_t)m * sizeof(double));
+    for (int i = 0; i < m; ++i) {
+        b[i] = 1.0;
+        x[i] = 0.0;
+    }
+    int rc = sp_solve_bicgstab_restarted(&A, b, x, tol, max_iter, HIT_RESTART, info);
+    if (rc == 0) {
+        t_solve_info gi;
+        int iters = info->iters;
+        rc = sp_solve_sor(&A, b, x, 1.0, tol, max_iter, &gi);
+        *info = gi;
+        info->iters += iters;
+    }
+    for (int i = 0; i < m; ++i) h[vert[i]] = x[i];
+
+    free(x);
+    free(b);
+    spmx_free(&A);
+    free(vert);
+    free(row_of);
+    return rc;
+}
@@ -1,67 +1,768 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h> // Pour isspace (vérif espaces dans .txt input)
+#include <stdint.h>
+#include <fcntl.h>     // open
+#include <sys/stat.h>  // fstat
+#include <pthread.h>   // lecture parallèle
+#ifndef _WIN32
+  #include <sys/mman.h> // mmap, munmap, madvise
+  #include <unistd.h>   // close
+#else
+  // <io.h> est masqué par include/io.h (-Iinclude) : déclaration directe des fonctions CRT
+  int __cdecl _open(const char *path, int flags, ...);
+  int __cdecl _close(int fd);
+  #define open  _open
+  #define close _close
+#endif
 #include "io.h"
 
-// Supprime les espaces blancs de fin de chaîne
-static void rtrim(char *s) {
-    if (!s) return;
-    size_t n = strlen(s);
-    // Boucle de la fin vers le début
-    while (n > 0 && (unsigned char)s[n - 1] <= ' ') {
-        // Remplace l'espace par le caractère nul
-        s[--n] = '\0';
-    }
-}
-
-// Retourne 1 si la ligne est vide ou un commentaire, 0 sinon
-static int is_comment_or_blank(const char *s) {
-    // Avance pointeur jusqu’au premier caractère non-espace
-    while (*s && isspace((unsigned char)*s)) ++s;
-    // ignore lignes vides, commentaires # ou //
-    if (*s == '\0') return 1;
-    if (*s == '#')  return 1;
-    if (*s == '/' && *(s + 1) == '/') return 1;
+// Fichier d'entrée accessible comme un seul bloc d'octets [data, data+len)
+typedef struct {
+    const char *data;  // début du contenu
+    size_t      len;   // taille en octets
+    void       *owned; // bloc à libérer (lecture classique), NULL si projeté
+    int         mapped; // 1 si obtenu par mmap
+} t_filebuf;
+
+// Statut d'analyse d'une ligne de triplet "from to proba"
+typedef enum {
+    LINE_SKIP = 0,    // ligne vide ou commentaire
+    LINE_EDGE,        // triplet valide
+    LINE_BAD_FORMAT,  // ligne illisible
+    LINE_BAD_VERTEX,  // sommet hors [1 ; N]
+    LINE_BAD_PROBA    // probabilité hors [0 ; 1]
+} t_line_status;
+
+// Espace au sens de isspace() dans la locale "C" (indépendant de la locale courante)
+static int is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+static int is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief  Charge un fichier entier en mémoire, par projection si possible
+ *
+ * Sous POSIX, le fichier est projeté en lecture seule (`mmap`) : aucune copie
+ * n'est faite et le système pagine à la demande. Si la projection échoue
+ * (fichier vide, pseudo-fichier, plateforme sans mmap), on retombe sur une
+ * lecture classique dans un tampon alloué.
+ *
+ * @param[in]  filename  Chemin du fichier
+ * @param[out] fb        Tampon résultat (à rendre via `unmap_file`)
+ *
+ * @return  0 si succès, -1 si le fichier ne peut pas être ouvert/lu
+ */
+static int map_file(const char *filename, t_filebuf *fb) {
+    fb->data = NULL;
+    fb->len = 0;
+    fb->owned = NULL;
+    fb->mapped = 0;
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return -1;
+    }
+
+#ifndef _WIN32
+    if (S_ISREG(st.st_mode) && st.st_size > 0) {
+        void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL); // lecture linéaire : read-ahead agressif
+            close(fd);
+            fb->data = (const char *)p;
+            fb->len = (size_t)st.st_size;
+            fb->mapped = 1;
+            return 0;
+        }
+    }
+#endif
+    close(fd);
+
+    // Repli : lecture complète par blocs
+    FILE *f = fopen(filename, "rb");
+    if (!f) return -1;
+    size_t cap = st.st_size > 0 ? (size_t)st.st_size : 4096;
+    char *buf = (char *)malloc(cap);
+    if (!buf) {
+        perror("malloc");
+        fclose(f);
+        exit(EXIT_FAILURE);
+    }
+    size_t len = 0;
+    size_t got;
+    while ((got = fread(buf + len, 1, cap - len, f)) > 0) {
+        len += got;
+        if (len == cap) {
+            cap *= 2;
+            char *nb = (char *)realloc(buf, cap);
+            if (!nb) {
+                perror("realloc");
+                free(buf);
+                fclose(f);
+                exit(EXIT_FAILURE);
+            }
+            buf = nb;
+        }
+    }
+    fclose(f);
+    fb->data = buf;
+    fb->len = len;
+    fb->owned = buf;
+    return 0;
+}
+
+// Libère le tampon obtenu par map_file
+static void unmap_file(t_filebuf *fb) {
+#ifndef _WIN32
+    if (fb->mapped) munmap((void *)fb->data, fb->len);
+#endif
+    free(fb->owned);
+    fb->data = NULL;
+    fb->len = 0;
+    fb->owned = NULL;
+    fb->mapped = 0;
+}
+
+// Retire les blancs (octets <= ' ') en fin de ligne [s, e) ; retourne la nouvelle fin
+static const char *rtrim(const char *s, const char *e) {
+    while (e > s && (unsigned char)e[-1] <= ' ') --e;
+    return e;
+}
+
+// Retourne 1 si la ligne [s, e) est vide ou un commentaire (# ou //), 0 sinon
+static int is_comment_or_blank(const char *s, const char *e) {
+    // Avance jusqu'au premier caractère non-espace
+    while (s < e && is_space(*s)) ++s;
+    if (s == e)   return 1;
+    if (*s == '#') return 1;
+    if (*s == '/' && s + 1 < e && s[1] == '/') return 1;
+    return 0;
+}
+
+/**
+ * @brief  Lit un entier décimal signé en tête de [*pp, e) (équivalent de "%d")
+ *
+ * Les espaces de tête sont ignorés. En cas de succès, `*pp` avance juste
+ * après le dernier chiffre lu.
+ *
+ * @return  1 si un entier a été lu (sans débordement), 0 sinon
+ */
+static int scan_int(const char **pp, const char *e, int *out) {
+    const char *s = *pp;
+    while (s < e && is_space(*s)) ++s;
+
+    int neg = 0;
+    if (s < e && (*s == '+' || *s == '-')) {
+        neg = (*s == '-');
+        ++s;
+    }
+    if (s == e || !is_digit(*s)) return 0;
+
+    long long v = 0;
+    while (s < e && is_digit(*s)) {
+        v = v * 10 + (*s - '0');
+        if (v > 2147483648LL) return 0; // hors de la plage d'un int
+        ++s;
+    }
+    if (neg) v = -v;
+    if (v > 2147483647LL) return 0;
+
+    *out = (int)v;
+    *pp = s;
+    return 1;
+}
+
+// Puissances de 10 exactement représentables en double
+static const double POW10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * @brief  Lit un flottant décimal en tête de [*pp, e) (équivalent de "%f")
+ *
+ * Forme acceptée : [signe] chiffres [. chiffres] [(e|E) [signe] chiffres],
+ * avec au moins un chiffre dans la mantisse (".5" et "5." sont valides).
+ * Le séparateur décimal est toujours '.', quelle que soit la locale.
+ * La mantisse est accumulée sur 19 chiffres significatifs dans un entier
+ * 64 bits puis mise à l'échelle en double avant conversion en float.
+ *
+ * @return  1 si un nombre a été lu, 0 sinon
+ */
+static int scan_float(const char **pp, const char *e, float *out) {
+    const char *s = *pp;
+    while (s < e && is_space(*s)) ++s;
+
+    int neg = 0;
+    if (s < e && (*s == '+' || *s == '-')) {
+        neg = (*s == '-');
+        ++s;
+    }
+
+    unsigned long long mant = 0;
+    int ndigits = 0;   // chiffres significatifs retenus dans mant
+    int exp10 = 0;     // exposant décimal à appliquer à mant
+    int seen = 0;      // au moins un chiffre dans la mantisse
+
+    while (s < e && is_digit(*s)) {
+        if (ndigits < 19) {
+            mant = mant * 10 + (unsigned)(*s - '0');
+            if (mant) ++ndigits;
+        } else {
+            ++exp10; // chiffre au-delà de la précision : seul l'ordre de grandeur compte
+        }
+        seen = 1;
+        ++s;
+    }
+    if (s < e && *s == '.') {
+        ++s;
+        while (s < e && is_digit(*s)) {
+            if (ndigits < 19) {
+                mant = mant * 10 + (unsigned)(*s - '0');
+                if (mant) ++ndigits;
+                --exp10;
+            }
+            seen = 1;
+            ++s;
+        }
+    }
+    if (!seen) return 0;
+
+    // Exposant optionnel : n'est consommé que s'il est bien formé
+    if (s < e && (*s == 'e' || *s == 'E')) {
+        const char *t = s + 1;
+        int eneg = 0;
+        if (t < e && (*t == '+' || *t == '-')) {
+            eneg = (*t == '-');
+            ++t;
+        }
+        if (t < e && is_digit(*t)) {
+            int ev = 0;
+            while (t < e && is_digit(*t)) {
+                if (ev < 100000) ev = ev * 10 + (*t - '0');
+                ++t;
+            }
+            exp10 += eneg ? -ev : ev;
+            s = t;
+        }
+    }
+
+    double v = (double)mant;
+    if (v != 0.0) {
+        // Mise à l'échelle par paquets de 10^22 (exacts), puis le reste
+        while (exp10 > 22 && v < 1e300) { v *= POW10[22]; exp10 -= 22; }
+        while (exp10 < -22 && v > 1e-300) { v /= POW10[22]; exp10 += 22; }
+        if (exp10 > 22)       v = 1e300 * 1e300; // débordement -> +inf
+        else if (exp10 < -22) v = 0.0;
+        else if (exp10 >= 0)  v *= POW10[exp10];
+        else                  v /= POW10[-exp10];
+    }
+
+    *out = (float)(neg ? -v : v);
+    *pp = s;
+    return 1;
+}
+
+/**
+ * @brief  Analyse une ligne "from to proba" (déjà débarrassée des blancs de fin)
+ *
+ * Les champs surnuméraires en fin de ligne sont ignorés, comme avec sscanf.
+ *
+ * @param[in]  s, e   Bornes de la ligne
+ * @param[in]  n      Nombre de sommets (bornes des identifiants)
+ * @param[out] from, to, p  Triplet lu (renseigné même si hors bornes, pour le diagnostic)
+ *
+ * @return  Statut de la ligne (voir t_line_status)
+ */
+static t_line_status parse_edge_line(const char *s, const char *e, int n,
+                                     int *from, int *to, float *p) {
+    if (is_comment_or_blank(s, e)) return LINE_SKIP;
+
+    const char *cur = s;
+    if (!scan_int(&cur, e, from) || !scan_int(&cur, e, to) || !scan_float(&cur, e, p)) {
+        return LINE_BAD_FORMAT;
+    }
+    // Vérification que from et to ∈ [1 ; N]
+    if (*from < 1 || *from > n || *to < 1 || *to > n) return LINE_BAD_VERTEX;
+    // Vérification que p ∈ [0 ; 1]
+    if (*p < 0.0f || *p > 1.0f) return LINE_BAD_PROBA;
+    return LINE_EDGE;
+}
+
+/**
+ * @brief  Affiche le diagnostic correspondant à une ligne rejetée
+ *
+ * @param[in] f       Flux de sortie (stderr)
+ * @param[in] st      Statut renvoyé par parse_edge_line
+ * @param[in] lineno  Numéro de ligne dans le fichier (à partir de 1)
+ * @param[in] s, e    Bornes de la ligne
+ */
+static void report_line(FILE *f, t_line_status st, int lineno, const char *s, const char *e,
+                        int n, int from, int to, float p) {
+    switch (st) {
+        case LINE_BAD_VERTEX:
+            fprintf(f, "[IO][ERR] L%d: sommet hors bornes: from=%d to=%d (1..%d)\n",
+                    lineno, from, to, n);
+            break;
+        case LINE_BAD_PROBA:
+            fprintf(f, "[IO][ERR] L%d: probabilité invalide: %.6f pour %d->%d\n",
+                    lineno, p, from, to);
+            break;
+        case LINE_BAD_FORMAT:
+            fprintf(f, "[IO][ERR] L%d: ligne invalide: '%.*s'\n", lineno, (int)(e - s), s);
+            break;
+        default:
+            break;
+    }
+}
+
+// Arête lue, en attente de placement dans le graphe
+typedef struct {
+    int   from;
+    int   to;
+    float p;
+} t_edge;
+
+// Ligne rejetée, mémorisée pour un affichage différé dans l'ordre du fichier
+typedef struct {
+    int           line;   // numéro de ligne relatif au début du morceau (0-basé)
+    t_line_status st;
+    int           from, to;
+    float         p;
+    const char   *s, *e;  // bornes de la ligne (dans le tampon du fichier)
+} t_bad_line;
+
+// Morceau de fichier [begin, end) analysé par un thread
+typedef struct {
+    const char *begin, *end;  // bornes, alignées sur des débuts de ligne
+    int         n;            // nombre de sommets
+    int         n_lines;      // nombre de lignes du morceau (rempli par parse_chunk)
+    t_edge     *edges;        // arêtes valides, dans l'ordre du fichier
+    size_t      n_edges, cap_edges;
+    t_bad_line *bad;          // lignes rejetées, dans l'ordre du fichier
+    size_t      n_bad, cap_bad;
+} t_chunk;
+
+// En dessous de cette taille par thread, le découpage coûte plus qu'il ne rapporte
+#define IO_MIN_CHUNK ((size_t)1 << 16)
+
+// realloc avec arrêt du programme en cas d'échec
+static void *xrealloc(void *p, size_t sz) {
+    void *q = realloc(p, sz);
+    if (!q && sz != 0) {
+        perror("realloc");
+        exit(EXIT_FAILURE);
+    }
+    return q;
+}
+
+/**
+ * @brief  Analyse toutes les lignes d'un morceau du fichier
+ *
+ * Arêtes valides et lignes rejetées sont accumulées dans des tampons propres
+ * au morceau ; ils sont fusionnés ensuite dans l'ordre des morceaux.
+ *
+ * @param[in,out] c  Morceau à analyser
+ */
+static void parse_chunk(t_chunk *c) {
+    const char *cur = c->begin;
+    int line = 0;
+
+    while (cur < c->end) {
+        const char *nl = (const char *)memchr(cur, '\n', (size_t)(c->end - cur));
+        const char *eol = nl ? nl : c->end;
+        const char *s = cur;
+        cur = nl ? nl + 1 : c->end;
+
+        const char *e = rtrim(s, eol);
+        int from = 0, to = 0;
+        float p = 0.0f;
+        t_line_status st = parse_edge_line(s, e, c->n, &from, &to, &p);
+
+        if (st == LINE_EDGE) {
+            if (c->n_edges == c->cap_edges) {
+                c->cap_edges = c->cap_edges ? c->cap_edges * 2 : 1024;
+                c->edges = (t_edge *)xrealloc(c->edges, c->cap_edges * sizeof(t_edge));
+            }
+            c->edges[c->n_edges].from = from;
+            c->edges[c->n_edges].to = to;
+            c->edges[c->n_edges].p = p;
+            c->n_edges++;
+        } else if (st != LINE_SKIP) {
+            if (c->n_bad == c->cap_bad) {
+                c->cap_bad = c->cap_bad ? c->cap_bad * 2 : 16;
+                c->bad = (t_bad_line *)xrealloc(c->bad, c->cap_bad * sizeof(t_bad_line));
+            }
+            t_bad_line *b = &c->bad[c->n_bad++];
+            b->line = line;
+            b->st = st;
+            b->from = from;
+            b->to = to;
+            b->p = p;
+            b->s = s;
+            b->e = e;
+        }
+        ++line;
+    }
+    c->n_lines = line;
+}
+
+// Point d'entrée d'un thread d'analyse
+static void *parse_worker(void *arg) {
+    parse_chunk((t_chunk *)arg);
+    return NULL;
+}
+
+/**
+ * @brief  Construit le CSR du graphe à partir des arêtes des morceaux
+ *
+ * Passe 1 : comptage des degrés sortants puis sommes préfixes.
+ * Passe 2 : placement de chaque arête. Les arêtes d'un même sommet sont
+ * rangées de la dernière lue à la première (même ordre de parcours que
+ * l'insertion en tête de graph_add_edge).
+ *
+ * @param[in]     chunks   Morceaux analysés, dans l'ordre du fichier
+ * @param[in]     nchunks  Nombre de morceaux
+ * @param[in,out] g        Graphe initialisé à N sommets, sans arête
+ */
+static void build_csr(const t_chunk *chunks, int nchunks, AdjList *g) {
+    int64_t nnz = 0;
+    for (int t = 0; t < nchunks; ++t) nnz += (int64_t)chunks[t].n_edges;
+    if (nnz == 0) return;
+    graph_reserve(g, nnz);
+
+    // Passe 1 : offsets[i+1] = degré sortant du sommet i+1, puis fin de sa plage
+    int64_t *off = g->offsets;
+    for (int t = 0; t < nchunks; ++t) {
+        for (size_t k = 0; k < chunks[t].n_edges; ++k) off[chunks[t].edges[k].from]++;
+    }
+    for (int i = 1; i <= g->size; ++i) off[i] += off[i - 1];
+
+    // Passe 2 : chaque arête prend la dernière case libre de sa plage ;
+    // à la fin, off[i+1] vaut le début de la plage du sommet i+1
+    for (int t = 0; t < nchunks; ++t) {
+        for (size_t k = 0; k < chunks[t].n_edges; ++k) {
+            const t_edge *ed = &chunks[t].edges[k];
+            int64_t pos = --off[ed->from];
+            g->dests[pos] = ed->to;
+            g->probas[pos] = ed->p;
+        }
+    }
+    memmove(off, off + 1, (size_t)g->size * sizeof(int64_t));
+    off[g->size] = nnz;
+    g->nnz = nnz;
+}
+
+/**
+ * @brief  Analyse [body, end) puis remplit le graphe
+ *
+ * Avec plusieurs threads, le corps du fichier est découpé en morceaux de
+ * tailles voisines, alignés sur des fins de ligne, chacun analysé dans ses
+ * propres tampons. La fusion se fait dans l'ordre des morceaux, si bien que
+ * le graphe et les diagnostics (numéros de ligne compris) sont identiques à
+ * ceux de la lecture séquentielle.
+ *
+ * @param[in]     body, end   Corps du fichier (après la ligne de N)
+ * @param[in]     first_line  Numéro de la première ligne du corps
+ * @param[in]     nthreads    Nombre de morceaux/threads (>= 1)
+ * @param[in,out] g           Graphe initialisé à N sommets
+ */
+static void parse_body(const char *body, const char *end, int first_line,
+                       int nthreads, AdjList *g) {
+    t_chunk *chunks = (t_chunk *)calloc((size_t)nthreads, sizeof(t_chunk));
+    pthread_t *tids = (pthread_t *)malloc((size_t)nthreads * sizeof(pthread_t));
+    int *started = (int *)calloc((size_t)nthreads, sizeof(int));
+    if (!chunks || !tids || !started) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    // Découpage : chaque frontière est repoussée au début de la ligne suivante
+    size_t len = (size_t)(end - body);
+    const char *prev = body;
+    for (int t = 0; t < nthreads; ++t) {
+        const char *stop = end;
+        if (t + 1 < nthreads) {
+            const char *target = body + len / (size_t)nthreads * (size_t)(t + 1);
+            if (target <= prev) target = prev + 1;
+            if (target > end) target = end;
+            const char *nl = (const char *)memchr(target - 1, '\n', (size_t)(end - (target - 1)));
+            stop = nl ? nl + 1 : end;
+        }
+        chunks[t].begin = prev;
+        chunks[t].end = stop;
+        chunks[t].n = g->size;
+        prev = stop;
+    }
+
+    // Analyse : un thread par morceau (le morceau 0 est traité par l'appelant)
+    for (int t = 1; t < nthreads; ++t) {
+        started[t] = (pthread_create(&tids[t], NULL, parse_worker, &chunks[t]) == 0);
+        if (!started[t]) parse_chunk(&chunks[t]); // repli : analyse sur place
+    }
+    parse_chunk(&chunks[0]);
+    for (int t = 1; t < nthreads; ++t) {
+        if (started[t]) pthread_join(tids[t], NULL);
+    }
+
+    // Diagnostics dans l'ordre du fichier
+    int line_base = first_line;
+    for (int t = 0; t < nthreads; ++t) {
+        const t_chunk *c = &chunks[t];
+        for (size_t i = 0; i < c->n_bad; ++i) {
+            const t_bad_line *b = &c->bad[i];
+            report_line(stderr, b->st, line_base + b->line, b->s, b->e, c->n, b->from, b->to, b->p);
+        }
+        line_base += c->n_lines;
+    }
+
+    // Construction du graphe
+    build_csr(chunks, nthreads, g);
+
+    for (int t = 0; t < nthreads; ++t) {
+        free(chunks[t].edges);
+        free(chunks[t].bad);
+    }
+    free(started);
+    free(tids);
+    free(chunks);
+}
+
+// Signature des fichiers binaires (.mgb) ; 0x1A évite toute confusion avec un fichier texte
+static const char MGB_MAGIC[4] = {'M', 'G', 'B', '\x1a'};
+#define MGB_VERSION 1u
+#define MGB_ENDIAN  0x01020304u
+
+// En-tête d'un fichier .mgb (32 octets), suivi des tableaux CSR du graphe :
+//   int64 offsets[N+1]  : sorties du sommet i+1 = [offsets[i], offsets[i+1])
+//   int32 dests[nnz]    : destinations (1..N)
+//   float probas[nnz]   : probabilités
+typedef struct {
+    char     magic[4];
+    uint32_t version;
+    uint32_t endian;    // MGB_ENDIAN dans l'ordre des octets de l'écrivain
+    int32_t  n;         // nombre de sommets
+    int64_t  nnz;       // nombre d'arêtes
+    int64_t  reserved;  // 0
+} t_mgb_header;
+
+// Retourne 1 si le tampon commence par la signature .mgb
+static int is_mgb(const t_filebuf *fb) {
+    return fb->len >= sizeof(MGB_MAGIC) && memcmp(fb->data, MGB_MAGIC, sizeof(MGB_MAGIC)) == 0;
+}
+
+// Erreur fatale de lecture binaire : message, libération du tampon, arrêt
+static void mgb_fail(t_filebuf *fb, const char *filename, const char *why) {
+    fprintf(stderr, "[IO][ERR] Fichier binaire '%s' invalide : %s\n", filename, why);
+    unmap_file(fb);
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief  Construit le graphe à partir d'un fichier .mgb déjà chargé
+ *
+ * L'en-tête et les tableaux sont validés (taille du fichier, offsets
+ * croissants, destinations dans [1 ; N]). Si le fichier est projeté, les
+ * tableaux CSR du graphe pointent directement dans la projection, dont le
+ * graphe devient propriétaire (aucune copie ni allocation par arête).
+ * Sinon, les tableaux sont recopiés.
+ *
+ * @param[in,out] fb        Fichier chargé (repris par le graphe ou libéré)
+ * @param[in]     filename  Nom du fichier (messages d'erreur)
+ * @param[out]    out       Graphe résultat
+ */
+static void load_mgb(t_filebuf *fb, const char *filename, AdjList *out) {
+    t_mgb_header h;
+    if (fb->len < sizeof(h)) mgb_fail(fb, filename, "en-tête tronqué");
+    memcpy(&h, fb->data, sizeof(h));
+
+    if (h.endian != MGB_ENDIAN)  mgb_fail(fb, filename, "ordre des octets incompatible");
+    if (h.version != MGB_VERSION) mgb_fail(fb, filename, "version non supportée");
+    if (h.n <= 0 || h.nnz < 0)   mgb_fail(fb, filename, "N ou nombre d'arêtes invalide");
+
+    // Tailles bornées avant tout produit : un en-tête forgé ne doit pas faire
+    // déborder le calcul de la taille attendue
+    const size_t edge_bytes = sizeof(int32_t) + sizeof(float);
+    if ((uint64_t)h.n + 1 > (SIZE_MAX - sizeof(h)) / sizeof(int64_t)) {
+        mgb_fail(fb, filename, "N trop grand");
+    }
+    size_t n = (size_t)h.n;
+    size_t head = sizeof(h) + (n + 1) * sizeof(int64_t);
+    if (h.nnz > INT64_MAX / (int64_t)edge_bytes || (uint64_t)h.nnz > (SIZE_MAX - head) / edge_bytes) {
+        mgb_fail(fb, filename, "nombre d'arêtes trop grand");
+    }
+    size_t nnz = (size_t)h.nnz;
+    size_t expected = head + nnz * edge_bytes;
+    if (fb->len != expected) mgb_fail(fb, filename, "taille de fichier incohérente");
+
+    // Tableaux lus en place (alignés : en-tête de 32 octets, offsets sur 8)
+    const int64_t *offsets = (const int64_t *)(fb->data + sizeof(h));
+    const int32_t *dests = (const int32_t *)(offsets + n + 1);
+    const float *probas = (const float *)(dests + nnz);
+
+    if (offsets[0] != 0 || offsets[n] != h.nnz) mgb_fail(fb, filename, "offsets incohérents");
+    for (size_t i = 0; i < n; ++i) {
+        if (offsets[i + 1] < offsets[i]) mgb_fail(fb, filename, "offsets non croissants");
+    }
+    for (size_t k = 0; k < nnz; ++k) {
+        if (dests[k] < 1 || dests[k] > h.n) mgb_fail(fb, filename, "destination hors bornes");
+    }
+
+    if (fb->mapped && sizeof(int) == sizeof(int32_t)) {
+        // Zéro copie : le graphe pointe dans la projection et la libérera
+        out->size = h.n;
+        out->nnz = h.nnz;
+        out->offsets = (int64_t *)offsets;
+        out->dests = (int *)dests;
+        out->probas = (float *)probas;
+        out->cap = 0;
+        out->map = (void *)fb->data;
+        out->map_len = fb->len;
+#ifndef _WIN32
+        madvise(out->map, out->map_len, MADV_NORMAL); // accès non séquentiels à venir
+#endif
+        fb->mapped = 0;
+        fb->data = NULL;
+        fb->len = 0;
+        return;
+    }
+
+    graph_init(out, h.n);
+    graph_reserve(out, h.nnz);
+    memcpy(out->offsets, offsets, (n + 1) * sizeof(int64_t));
+    for (size_t k = 0; k < nnz; ++k) {
+        out->dests[k] = dests[k];
+        out->probas[k] = probas[k];
+    }
+    out->nnz = h.nnz;
+}
+
+/**
+ * @brief  Écrit un graphe au format binaire .mgb
+ *
+ * Les tableaux CSR sont écrits tels quels : une relecture redonne exactement
+ * le même graphe (ordre des arêtes compris).
+ *
+ * @param[in] g        Graphe à écrire
+ * @param[in] outfile  Chemin du fichier de sortie
+ *
+ * @return  0 si succès, -1 en cas d'erreur (message sur stderr)
+ */
+int write_graph_binary(const AdjList *g, const char *outfile) {
+    if (!g || g->size <= 0 || !g->offsets || !outfile) {
+        fprintf(stderr, "[write_graph_binary] invalid arguments (g/outfile)\n");
+        return -1;
+    }
+
+    FILE *f = fopen(outfile, "wb");
+    if (!f) {
+        perror("fopen(outfile)");
+        return -1;
+    }
+
+    t_mgb_header h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, MGB_MAGIC, sizeof(MGB_MAGIC));
+    h.version = MGB_VERSION;
+    h.endian = MGB_ENDIAN;
+    h.n = g->size;
+    h.nnz = g->nnz;
+
+    size_t n1 = (size_t)g->size + 1;
+    size_t nnz = (size_t)g->nnz;
+    int ok = fwrite(&h, sizeof(h), 1, f) == 1
+          && fwrite(g->offsets, sizeof(int64_t), n1, f) == n1;
+    if (ok && nnz > 0) {
+        ok = fwrite(g->dests, sizeof(int32_t), nnz, f) == nnz
+          && fwrite(g->probas, sizeof(float), nnz, f) == nnz;
+    }
+
+    if (fclose(f) != 0 || !ok) {
+        perror("fwrite(outfile)");
+        return -1;
+    }
     return 0;
 }
 
 /**
  * @brief Lit un graphe depuis un fichier texte et le stocke dans une structure AdjList.
  *
+ * Un fichier binaire .mgb (voir write_graph_binary) est reconnu à sa
+ * signature et chargé directement. Sinon, le fichier est projeté en mémoire
+ * et analysé sur place par un lecteur dédié (sans sscanf ni dépendance à la
+ * locale) : les lignes peuvent être de longueur quelconque. Les numéros de
+ * ligne des diagnostics sont ceux du fichier (commentaires et lignes vides
+ * compris).
+ *
  * @param filename  Nom du fichier à lire
  * @param out      Pointeur vers la structure AdjList où stocker le graphe lu
  */
 void read_graph_from_file(const char *filename, AdjList *out) {
-    // Ouverture du fichier en lecture texte
-    FILE *f = fopen(filename, "rt");
-    if (!f) {
-        perror("[IO] fopen");
+    read_graph_from_file_mt(filename, out, 1);
+}
+
+/**
+ * @brief Variante de read_graph_from_file avec analyse multi-thread.
+ *
+ * Le résultat (graphe et diagnostics) est identique à la lecture séquentielle
+ * quel que soit `nthreads`. Le nombre de threads effectif est réduit pour les
+ * petits fichiers (au moins IO_MIN_CHUNK octets par thread).
+ *
+ * @param filename  Nom du fichier à lire
+ * @param out       Pointeur vers la structure AdjList où stocker le graphe lu
+ * @param nthreads  Nombre de threads souhaité (<= 1 : lecture séquentielle)
+ */
+void read_graph_from_file_mt(const char *filename, AdjList *out, int nthreads) {
+    // Projection du fichier en mémoire
+    t_filebuf fb;
+    if (map_file(filename, &fb) != 0) {
+        perror("[IO] open");
         fprintf(stderr, "[IO][ERR] Impossible d'ouvrir '%s'\n", filename);
         exit(EXIT_FAILURE);
     }
 
+    // Format binaire reconnu à sa signature
+    if (is_mgb(&fb)) {
+        load_mgb(&fb, filename, out);
+        unmap_file(&fb);
+        return;
+    }
+
+    const char *cur = fb.data;
+    const char *end = fb.data + fb.len;
+    int lineno = 0;
+
     // Lecture de N : on saute lignes vides/commentées jusqu’à trouver un entier
     int n = -1; // Nombre de sommets
+    while (cur < end) {
+        const char *nl = (const char *)memchr(cur, '\n', (size_t)(end - cur));
+        const char *eol = nl ? nl : end;
+        const char *s = cur;
+        cur = nl ? nl + 1 : end;
+        ++lineno;
 
-    // Variable pour stocker chaque ligne lue
-    char line[256];
-    // Boucle lecture ligne par ligne
-    while (fgets(line, sizeof(line), f)) {
-        // Vérifie si la ligne est un commentaire ou vide
-        rtrim(line);
-        if (is_comment_or_blank(line)) continue;
+        const char *e = rtrim(s, eol);
+        if (is_comment_or_blank(s, e)) continue;
         // Vérifie si la ligne contient un entier
-        if (sscanf(line, "%d", &n) == 1) break;
-        fprintf(stderr, "[IO][ERR] Ligne invalide pour N: '%s'\n", line);
-        fclose(f);
+        const char *t = s;
+        if (scan_int(&t, e, &n)) break;
+        fprintf(stderr, "[IO][ERR] Ligne invalide pour N: '%.*s'\n", (int)(e - s), s);
+        unmap_file(&fb);
         exit(EXIT_FAILURE);
     }
 
     // Vérification de N
     if (n <= 0) {
         fprintf(stderr, "[IO][ERR] Nombre de sommets N invalide (%d).\n", n);
-        fclose(f);
+        unmap_file(&fb);
         exit(EXIT_FAILURE);
     }
 
@@ -69,42 +770,221 @@ void read_graph_from_file(const char *filename, AdjList *out) {
     graph_init(out, n);
 
     // Lecture des triples : from to proba
-    int from, to;
-    float p;
+    size_t body_len = (size_t)(end - cur);
+    if (nthreads > 1 && (size_t)nthreads > body_len / IO_MIN_CHUNK) {
+        nthreads = (int)(body_len / IO_MIN_CHUNK);
+    }
+    if (nthreads < 1) nthreads = 1;
+    parse_body(cur, end, lineno + 1, nthreads, out);
+
+    unmap_file(&fb);
+}
+
+/**
+ * @brief  Initialise un ensemble vide de distributions initiales
+ *
+ * @param[out] ds  Ensemble à initialiser (à libérer via dist_starts_free)
+ */
+void dist_starts_init(t_dist_starts *ds) {
+    ds->count = 0;
+    ds->ptr = (int64_t *)xrealloc(NULL, 2 * sizeof(int64_t));
+    ds->ptr[0] = 0;
+    ds->ptr[1] = 0;
+    ds->vert = NULL;
+    ds->p = NULL;
+    ds->cap_count = 0;
+    ds->cap_nnz = 0;
+}
+
+// Libère un ensemble de distributions initiales
+void dist_starts_free(t_dist_starts *ds) {
+    free(ds->ptr);
+    free(ds->vert);
+    free(ds->p);
+    ds->count = 0;
+    ds->ptr = NULL;
+    ds->vert = NULL;
+    ds->p = NULL;
+    ds->cap_count = 0;
+    ds->cap_nnz = 0;
+}
+
+// Ajoute la masse p sur le sommet v à la distribution en cours de construction
+static void ds_push_entry(t_dist_starts *ds, int v, float p) {
+    int64_t nnz = ds->ptr[ds->count + 1];
+    if (nnz == ds->cap_nnz) {
+        ds->cap_nnz = ds->cap_nnz ? ds->cap_nnz * 2 : 64;
+        ds->vert = (int *)xrealloc(ds->vert, (size_t)ds->cap_nnz * sizeof(int));
+        ds->p = (float *)xrealloc(ds->p, (size_t)ds->cap_nnz * sizeof(float));
+    }
+    ds->vert[nnz] = v;
+    ds->p[nnz] = p;
+    ds->ptr[ds->count + 1] = nnz + 1; // fin provisoire de la distribution en cours
+}
 
-    // Lecture ligne par ligne
-    char buf[256];
-    // Variable pour stocker le numéro de ligne pour messages d'erreur
-    int lineno = 1;
-    // Boucle de lecture des lignes restantes
-    while (fgets(buf, sizeof(buf), f)) {
+// Clôt la distribution en cours : elle devient la distribution d'indice count
+static void ds_close_start(t_dist_starts *ds) {
+    if (ds->count + 1 > ds->cap_count) {
+        ds->cap_count = ds->cap_count ? ds->cap_count * 2 : 16;
+        ds->ptr = (int64_t *)xrealloc(ds->ptr, (size_t)(ds->cap_count + 2) * sizeof(int64_t));
+    }
+    ds->count++;
+    ds->ptr[ds->count + 1] = ds->ptr[ds->count];
+}
+
+/**
+ * @brief  Parcourt une liste "V[,V|A-B...]" élément par élément
+ *
+ * Chaque élément valide (sommet seul ou intervalle A-B inclus dans
+ * [1 ; n]) est passé à visit ; les autres sont signalés sur stderr avec le
+ * nom de l'option.
+ *
+ * @param[in]  list    Liste séparée par des virgules
+ * @param[in]  n       Nombre de sommets du graphe
+ * @param[in]  option  Option d'origine, pour les messages (ex. "--dist-start")
+ * @param[in]  visit   Appelée avec les bornes [a ; b] de chaque élément
+ * @param[in]  ctx     Contexte transmis à visit
+ *
+ * @return  Nombre d'éléments rejetés
+ */
+static int parse_vertex_list(const char *list, int n, const char *option,
+                             void (*visit)(int a, int b, void *ctx), void *ctx) {
+    int rejected = 0;
+    const char *cur = list;
+    const char *end = list + strlen(list);
+    while (cur <= end) {
+        const char *comma = (const char *)memchr(cur, ',', (size_t)(end - cur));
+        const char *stop = comma ? comma : end;
+        const char *e = rtrim(cur, stop);
+
+        const char *t = cur;
+        int a = 0, b = 0;
+        int ok = scan_int(&t, e, &a);
+        b = a;
+        if (ok && t < e && *t == '-') {
+            ++t;
+            ok = scan_int(&t, e, &b);
+        }
+        if (!ok || t != e || a < 1 || b < a || b > n) {
+            fprintf(stderr, "[IO][ERR] %s: élément invalide '%.*s' (sommets 1..%d)\n",
+                    option, (int)(e - cur), cur, n);
+            rejected++;
+        } else {
+            visit(a, b, ctx);
+        }
+        cur = stop + 1;
+    }
+    return rejected;
+}
+
+static void visit_dist_start(int a, int b, void *ctx) {
+    t_dist_starts *ds = (t_dist_starts *)ctx;
+    for (int v = a; v <= b; ++v) {
+        ds_push_entry(ds, v, 1.0f);
+        ds_close_start(ds);
+    }
+}
+
+static void visit_vertex_set(int a, int b, void *ctx) {
+    unsigned char *mark = (unsigned char *)ctx;
+    for (int v = a; v <= b; ++v) mark[v] = 1;
+}
+
+/**
+ * @brief  Ajoute les sommets de départ d'une liste "V[,V|A-B...]"
+ *
+ * Chaque sommet (ou chaque sommet d'un intervalle A-B) donne une
+ * distribution concentrée en ce sommet, dans l'ordre de la liste.
+ *
+ * @param[in]     list  Liste séparée par des virgules
+ * @param[in]     n     Nombre de sommets du graphe
+ * @param[in,out] ds    Ensemble complété
+ *
+ * @return  Nombre d'éléments rejetés
+ */
+int parse_dist_start_list(const char *list, int n, t_dist_starts *ds) {
+    return parse_vertex_list(list, n, "--dist-start", visit_dist_start, ds);
+}
+
+/**
+ * @brief  Marque les sommets d'une liste "V[,V|A-B...]"
+ *
+ * @param[in]     list    Liste séparée par des virgules
+ * @param[in]     n       Nombre de sommets du graphe
+ * @param[in]     option  Option d'origine, pour les messages d'erreur
+ * @param[in,out] mark    [n+1] mark[v] passe à 1 pour chaque sommet listé
+ *
+ * @return  Nombre d'éléments rejetés
+ */
+int parse_vertex_set(const char *list, int n, const char *option, unsigned char *mark) {
+    return parse_vertex_list(list, n, option, visit_vertex_set, mark);
+}
+
+/**
+ * @brief  Ajoute les distributions initiales lues dans un fichier texte
+ *
+ * Une distribution par ligne : "V" (masse 1 en V) ou "V p V p ..." ; un
+ * sommet répété voit ses masses additionnées.
+ *
+ * @param[in]     filename  Chemin du fichier
+ * @param[in]     n         Nombre de sommets du graphe
+ * @param[in,out] ds        Ensemble complété
+ *
+ * @return  Nombre de lignes rejetées, -1 si le fichier ne peut pas être ouvert
+ */
+int read_dist_starts(const char *filename, int n, t_dist_starts *ds) {
+    t_filebuf fb;
+    if (map_file(filename, &fb) != 0) {
+        perror("[IO] open");
+        fprintf(stderr, "[IO][ERR] Impossible d'ouvrir '%s'\n", filename);
+        return -1;
+    }
+
+    const char *cur = fb.data;
+    const char *end = fb.data + fb.len;
+    int lineno = 0;
+    int rejected = 0;
+    while (cur < end) {
+        const char *nl = (const char *)memchr(cur, '\n', (size_t)(end - cur));
+        const char *s = cur;
+        const char *e = rtrim(s, nl ? nl : end);
+        cur = nl ? nl + 1 : end;
         ++lineno;
-        rtrim(buf);
-        if (is_comment_or_blank(buf)) continue;
-
-        // matched stock un entier : nombre d’éléments lus par sscanf (0 à 3)
-        int matched = sscanf(buf, "%d %d %f", &from, &to, &p);
-        // Si 3 éléments lus
-        if (matched == 3) {
-            // Vérification que from et to ∈ [1 ; N]
-            if (from < 1 || from > n || to < 1 || to > n) {
-                fprintf(stderr, "[IO][ERR] L%d: sommet hors bornes: from=%d to=%d (1..%d)\n",
-                        lineno, from, to, n);
-                continue;
-            }
-            // vérification que p ∈ [0 ; 1]
-            if (p < 0.0f || p > 1.0f) {
-                fprintf(stderr, "[IO][ERR] L%d: probabilité invalide: %.6f pour %d->%d\n",
-                        lineno, p, from, to);
-                continue;
+        if (is_comment_or_blank(s, e)) continue;
+
+        // Ligne "V" seule : masse 1 ; sinon paires "V p"
+        const char *t = s;
+        int v = 0;
+        float p = 1.0f;
+        int ok = scan_int(&t, e, &v) && v >= 1 && v <= n;
+        if (ok) {
+            const char *after_first = t;
+            while (t < e && is_space(*t)) ++t;
+            if (t == e) {
+                ds_push_entry(ds, v, 1.0f);
+            } else {
+                t = after_first;
+                int64_t mark = ds->ptr[ds->count + 1];
+                while (ok) {
+                    ok = scan_float(&t, e, &p) && p >= 0.0f;
+                    if (!ok) break;
+                    ds_push_entry(ds, v, p);
+                    while (t < e && is_space(*t)) ++t;
+                    if (t == e) break;
+                    ok = scan_int(&t, e, &v) && v >= 1 && v <= n;
+                }
+                if (!ok) ds->ptr[ds->count + 1] = mark; // annule les paires déjà lues
             }
-            // Empile les arêtes dans le graphe
-            graph_add_edge(out, from, to, p);
-        } else {
-            fprintf(stderr, "[IO][ERR] L%d: ligne invalide: '%s'\n", lineno, buf);
+        }
+        if (!ok) {
+            fprintf(stderr, "[IO][ERR] L%d: distribution initiale invalide (attendu 'V' ou 'V p V p ...', sommets 1..%d): '%.*s'\n",
+                    lineno, n, (int)(e - s), s);
+            rejected++;
             continue;
         }
+        ds_close_start(ds);
     }
 
-    fclose(f);
-}
\ No newline at end of file
+    unmap_file(&fb);
+    return rejected;
+}
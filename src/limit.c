@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "limit.h"
+
+/*
+ * Matrice limite par décomposition en classes. Partant de i, la chaîne
+ * finit dans une classe persistante C avec la probabilité a(i, C) (1 si
+ * i est dans C, absorption si i est transitoire), puis la moyenne de
+ * Cesàro de son temps passé en j ∈ C vaut pi_C[j], que C soit périodique
+ * ou non. Coût : une résolution stationnaire par classe persistante et
+ * une absorption multi-seconds membres, au lieu de puissances denses en
+ * O(iters · n³) qui ne convergent pas sur les classes périodiques.
+ */
+
+static void *xmalloc(size_t sz) {
+    void *q = malloc(sz ? sz : 1);
+    if (!q) {
+        perror("malloc(limit)");
+        exit(EXIT_FAILURE);
+    }
+    return q;
+}
+
+/**
+ * @brief  Construit la matrice limite de Cesàro sous forme factorisée
+ *
+ * Les cibles sont les classes persistantes dans l'ordre des indices de
+ * classe, comme dans absorption_compute. Une classe d'un seul état a
+ * pi = 1 sans résolution.
+ *
+ * @param[in]  g              Graphe
+ * @param[in]  p              Partition en classes de g
+ * @param[in]  is_persistent  [p->count] 1 si la classe est persistante
+ * @param[in]  S              Matrice de transition creuse de g
+ * @param[in]  solver         Solveur des stationnaires (power ne converge
+ *                            pas sur une classe périodique : préférer auto)
+ * @param[in]  eps            Tolérance des stationnaires
+ * @param[in]  max_iter       Itérations max des stationnaires
+ * @param[in]  omega          Relaxation de STAT_SOR
+ * @param[out] out            Résultat (à libérer par limit_free)
+ *
+ * @return  1 si toutes les résolutions ont convergé, 0 sinon
+ */
+int limit_build(const AdjList *g, const Partition *p, const int *is_persistent, const t_spmatrix *S,
+                t_stat_solver solver, float eps, int max_iter, double omega, t_limit *out) {
+    int n = g->size;
+    memset(out, 0, sizeof(*out));
+    out->n = n;
+    out->pi = xmalloc(((size_t)n + 1) * sizeof(float));
+    out->target_of = xmalloc(((size_t)n + 1) * sizeof(int));
+    out->pi[0] = 0.0f;
+    out->target_of[0] = -1;
+    int converged = 1;
+
+    int nt = 0;
+    for (int k = 0; k < p->count; ++k) {
+        SccClass c = scc_class(p, k);
+        if (!is_persistent[k]) {
+            for (int i = 0; i < c.count; ++i) {
+                out->pi[c.verts[i]] = 0.0f;
+                out->target_of[c.verts[i]] = -1;
+            }
+            continue;
+        }
+        int t = nt++;
+        for (int i = 0; i < c.count; ++i) out->target_of[c.verts[i]] = t;
+        if (c.count == 1) {
+            out->pi[c.verts[0]] = 1.0f;
+            continue;
+        }
+        t_spmatrix sub = spmx_sub(S, *p, k);
+        float *pi = xmalloc((size_t)sub.n * sizeof(float));
+        t_solve_info info;
+        if (stationary_solve(&sub, solver, eps, max_iter, omega, pi, &info) != 1) converged = 0;
+        for (int i = 0; i < c.count; ++i) out->pi[c.verts[i]] = pi[i];
+        free(pi);
+        spmx_free(&sub);
+    }
+
+    int rc = absorption_compute(g, p, is_persistent, ABSORB_TOL, ABSORB_MAX_ITER, &out->abs);
+    if (rc != 1) converged = 0;
+    out->converged = converged;
+    return converged;
+}
+
+void limit_free(t_limit *L) {
+    if (!L) return;
+    free(L->pi);
+    free(L->target_of);
+    absorption_free(&L->abs);
+    memset(L, 0, sizeof(*L));
+}
+
+/**
+ * @brief  Coefficient Pi[i][j] de la matrice limite
+ *
+ * @param[in]  L  Matrice limite factorisée
+ * @param[in]  i  État de départ (1..n)
+ * @param[in]  j  État d'arrivée (1..n)
+ *
+ * @return  Probabilité limite (moyenne de Cesàro) d'être en j partant de i
+ */
+double limit_entry(const t_limit *L, int i, int j) {
+    int t = L->target_of[j];
+    if (t < 0) return 0.0;
+    int ti = L->target_of[i];
+    if (ti >= 0) return (ti == t) ? (double)L->pi[j] : 0.0;
+    return absorption_prob(&L->abs, i, t) * (double)L->pi[j];
+}
+
+/**
+ * @brief  Développe la matrice limite en matrice dense n×n
+ *
+ * @param[in]  L    Matrice limite factorisée
+ * @param[out] out  Matrice dense (libérée puis réallouée)
+ */
+void limit_to_dense(const t_limit *L, t_matrix *out) {
+    mx_free(out);
+    *out = mx_zeros(L->n);
+    for (int i = 1; i <= L->n; ++i) {
+        for (int j = 1; j <= L->n; ++j) {
+            out->a[i - 1][j - 1] = (float)limit_entry(L, i, j);
+        }
+    }
+}
+
+/**
+ * @brief  Plus grand écart entre une matrice dense et la matrice limite
+ *
+ * Sert à valider le calcul par classes contre l'ancienne recherche de
+ * convergence mx_power_until_diff (chaînes apériodiques seulement : sur
+ * une classe périodique, M^n ne converge pas).
+ *
+ * @param[in]  L  Matrice limite factorisée
+ * @param[in]  M  Matrice dense n×n (ex. M^n)
+ *
+ * @return  max |M[i][j] - Pi[i][j]|, -1 si les tailles diffèrent
+ */
+double limit_max_diff(const t_limit *L, const t_matrix *M) {
+    if (!M || M->n != L->n) return -1.0;
+    double worst = 0.0;
+    for (int i = 1; i <= L->n; ++i) {
+        for (int j = 1; j <= L->n; ++j) {
+            double d = (double)M->a[i - 1][j - 1] - limit_entry(L, i, j);
+            if (d < 0.0) d = -d;
+            if (d > worst) worst = d;
+        }
+    }
+    return worst;
+}
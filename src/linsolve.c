@@ -0,0 +1,360 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linsolve.h"
+
+/*
+ * Solveurs itératifs pour (I - A) x = b, A au format CSR. Les chaînes de
+ * Markov donnent toujours cette forme : bloc transitoire Q pour l'absorption
+ * et les temps d'atteinte, bloc réduit transposé pour la stationnaire. Le
+ * produit par I - A se fait ligne par ligne (lecture contiguë de A), sans
+ * jamais former de matrice dense.
+ */
+
+// Valeur absolue sans dépendre de libm
+static double dabs(double v) {
+    return v < 0.0 ? -v : v;
+}
+
+// y = (I - A) x
+static void apply_i_minus_a(const t_spmatrix *A, const double *x, double *y) {
+    for (int i = 0; i < A->n; ++i) {
+        double s = 0.0;
+        for (int64_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; ++k) {
+            s += (double)A->val[k] * x[A->col[k]];
+        }
+        y[i] = x[i] - s;
+    }
+}
+
+// Norme L1 de b - (I - A) x (r reçoit le résidu si non NULL)
+static double residual_l1(const t_spmatrix *A, const double *b, const double *x, double *r) {
+    double sum = 0.0;
+    for (int i = 0; i < A->n; ++i) {
+        double s = 0.0;
+        for (int64_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; ++k) {
+            s += (double)A->val[k] * x[A->col[k]];
+        }
+        double ri = b[i] - (x[i] - s);
+        if (r) r[i] = ri;
+        sum += dabs(ri);
+    }
+    return sum;
+}
+
+static double dot(const double *u, const double *v, int n) {
+    double s = 0.0;
+    for (int i = 0; i < n; ++i) s += u[i] * v[i];
+    return s;
+}
+
+static double norm1(const double *u, int n) {
+    double s = 0.0;
+    for (int i = 0; i < n; ++i) s += dabs(u[i]);
+    return s;
+}
+
+/**
+ * @brief  Diagonale 1 - A[i][i] de I - A
+ *
+ * @return  Tableau de n valeurs (à libérer), NULL si un pivot est <= 0
+ */
+static double *diag_i_minus_a(const t_spmatrix *A) {
+    double *d = (double *)malloc((size_t)(A->n > 0 ? A->n : 1) * sizeof(double));
+    if (!d) {
+        perror("malloc(diag)");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < A->n; ++i) {
+        double aii = 0.0;
+        for (int64_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; ++k) {
+            if (A->col[k] == i) aii += (double)A->val[k];
+        }
+        d[i] = 1.0 - aii;
+        if (d[i] <= 0.0) {
+            free(d);
+            return NULL;
+        }
+    }
+    return d;
+}
+
+// Remplit le bilan (info peut être NULL)
+static void set_info(t_solve_info *info, int iters, double residual, int converged) {
+    if (!info) return;
+    info->iters = iters;
+    info->residual = residual;
+    info->converged = converged;
+}
+
+/**
+ * @brief  Résout (I - A) x = b par Gauss-Seidel / SOR
+ *
+ * Un balayage met à jour x[i] = (1 - omega) x[i]
+ *                              + omega (b[i] + sum_{j != i} A[i][j] x[j]) / (1 - A[i][i])
+ * en utilisant les x[j] déjà mis à jour dans le même balayage. Pour
+ * I - A M-matrice (A sous-stochastique, une sortie accessible de chaque
+ * état), Gauss-Seidel converge toujours, même quand la chaîne est
+ * périodique ou presque décomposable.
+ *
+ * @param[in]     A         Matrice creuse n×n
+ * @param[in]     b         Second membre (taille n)
+ * @param[in,out] x         Itéré de départ, puis solution (taille n)
+ * @param[in]     omega     Paramètre de relaxation (1 = Gauss-Seidel)
+ * @param[in]     tol       Tolérance relative sur ||b - (I - A) x||_1
+ * @param[in]     max_iter  Nombre maximal de balayages
+ * @param[out]    info      Bilan (peut être NULL)
+ *
+ * @return  1 si convergé, 0 sinon, -1 si un pivot 1 - A[i][i] est <= 0
+ */
+int sp_solve_sor(const t_spmatrix *A, const double *b, double *x,
+                 double omega, double tol, int max_iter, t_solve_info *info) {
+    set_info(info, 0, 0.0, 0);
+    if (!A || A->n <= 0 || !b || !x || omega <= 0.0 || omega >= 2.0) return -1;
+
+    int n = A->n;
+    double *diag = diag_i_minus_a(A);
+    if (!diag) return -1;
+
+    double target = tol * norm1(b, n);
+    double res = residual_l1(A, b, x, NULL);
+    int it = 0;
+    while (res > target && it < max_iter) {
+        for (int i = 0; i < n; ++i) {
+            double s = b[i];
+            for (int64_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; ++k) {
+                int j = A->col[k];
+                if (j != i) s += (double)A->val[k] * x[j];
+            }
+            x[i] = (1.0 - omega) * x[i] + omega * s / diag[i];
+        }
+        it++;
+        res = residual_l1(A, b, x, NULL);
+    }
+
+    free(diag);
+    set_info(info, it, res, res <= target);
+    return res <= target;
+}
+
+// Somme des normes L1 des colonnes de B - (I - A) X (X, B : n × nrhs par ligne)
+static double residual_l1_multi(const t_spmatrix *A, const double *B, const double *X, int nrhs,
+                                double *acc) {
+    double sum = 0.0;
+    for (int i = 0; i < A->n; ++i) {
+        const double *xi = X + (size_t)i * nrhs;
+        const double *bi = B + (size_t)i * nrhs;
+        for (int c = 0; c < nrhs; ++c) acc[c] = bi[c] - xi[c];
+        for (int64_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; ++k) {
+            const double a = (double)A->val[k];
+            const double *xj = X + (size_t)A->col[k] * nrhs;
+            for (int c = 0; c < nrhs; ++c) acc[c] += a * xj[c];
+        }
+        for (int c = 0; c < nrhs; ++c) sum += dabs(acc[c]);
+    }
+    return sum;
+}
+
+/**
+ * @brief  Résout (I - A) X = B pour nrhs seconds membres par Gauss-Seidel / SOR
+ *
+ * Même balayage que sp_solve_sor, mais chaque coefficient A[i][j] lu met à
+ * jour les nrhs composantes de la ligne i : le coût d'un balayage est
+ * O(nnz · nrhs) avec une seule lecture de la matrice, et les colonnes
+ * convergent au même rythme (même matrice d'itération).
+ *
+ * @param[in]     A         Matrice creuse n×n
+ * @param[in]     B         Seconds membres, n × nrhs rangés par ligne
+ * @param[in,out] X         Itéré de départ, puis solution (n × nrhs par ligne)
+ * @param[in]     nrhs      Nombre de seconds membres
+ * @param[in]     omega     Paramètre de relaxation (1 = Gauss-Seidel)
+ * @param[in]     tol       Tolérance relative sur la somme des résidus L1
+ * @param[in]     max_iter  Nombre maximal de balayages
+ * @param[out]    info      Bilan (peut être NULL)
+ *
+ * @return  1 si convergé, 0 sinon, -1 si un pivot 1 - A[i][i] est <= 0
+ */
+int sp_solve_sor_multi(const t_spmatrix *A, const double *B, double *X, int nrhs,
+                       double omega, double tol, int max_iter, t_solve_info *info) {
+    set_info(info, 0, 0.0, 0);
+    if (!A || A->n <= 0 || !B || !X || nrhs <= 0 || omega <= 0.0 || omega >= 2.0) return -1;
+
+    int n = A->n;
+    double *diag = diag_i_minus_a(A);
+    if (!diag) return -1;
+    double *acc = (double *)malloc((size_t)nrhs * sizeof(double));
+    if (!acc) {
+        perror("malloc(sor_multi)");
+        exit(EXIT_FAILURE);
+    }
+
+    double bnorm = 0.0;
+    for (size_t e = 0; e < (size_t)n * nrhs; ++e) bnorm += dabs(B[e]);
+    double target = tol * bnorm;
+    double res = residual_l1_multi(A, B, X, nrhs, acc);
+    int it = 0;
+    while (res > target && it < max_iter) {
+        for (int i = 0; i < n; ++i) {
+            double *xi = X + (size_t)i * nrhs;
+            memcpy(acc, B + (size_t)i * nrhs, (size_t)nrhs * sizeof(double));
+            for (int64_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; ++k) {
+                int j = A->col[k];
+                if (j == i) continue;
+                const double a = (double)A->val[k];
+                const double *xj = X + (size_t)j * nrhs;
+                for (int c = 0; c < nrhs; ++c) acc[c] += a * xj[c];
+            }
+            for (int c = 0; c < nrhs; ++c) {
+                xi[c] = (1.0 - omega) * xi[c] + omega * acc[c] / diag[i];
+            }
+        }
+        it++;
+        res = residual_l1_multi(A, B, X, nrhs, acc);
+    }
+
+    free(acc);
+    free(diag);
+    set_info(info, it, res, res <= target);
+    return res <= target;
+}
+
+/**
+ * @brief  Résout (I - A) x = b par BiCGSTAB préconditionné (Jacobi)
+ *
+ * Variante préconditionnée à droite de van der Vorst : deux produits par
+ * I - A par itération, six vecteurs de travail. Converge en bien moins
+ * d'itérations que Gauss-Seidel quand les classes sont presque
+ * décomposables, mais peut s'interrompre (rho ou omega nul) : le bilan
+ * indique alors une non-convergence.
+ *
+ * @param[in]     A         Matrice creuse n×n
+ * @param[in]     b         Second membre (taille n)
+ * @param[in,out] x         Itéré de départ, puis solution (taille n)
+ * @param[in]     tol       Tolérance relative sur ||b - (I - A) x||_1
+ * @param[in]     max_iter  Nombre maximal d'itérations
+ * @param[out]    info      Bilan (peut être NULL)
+ *
+ * @return  1 si convergé, 0 sinon, -1 si un pivot 1 - A[i][i] est <= 0
+ */
+int sp_solve_bicgstab(const t_spmatrix *A, const double *b, double *x,
+                      double tol, int max_iter, t_solve_info *info) {
+    set_info(info, 0, 0.0, 0);
+    if (!A || A->n <= 0 || !b || !x) return -1;
+
+    int n = A->n;
+    double *diag = diag_i_minus_a(A);
+    if (!diag) return -1;
+
+    double *work = (double *)malloc((size_t)n * 7 * sizeof(double));
+    if (!work) {
+        perror("malloc(bicgstab)");
+        exit(EXIT_FAILURE);
+    }
+    double *r = work, *r0 = work + n, *p = work + 2 * (size_t)n, *v = work + 3 * (size_t)n;
+    double *ph = work + 4 * (size_t)n, *sh = work + 5 * (size_t)n, *t = work + 6 * (size_t)n;
+    double *s = r; // s remplace r dans l'itération
+
+    double target = tol * norm1(b, n);
+    double res = residual_l1(A, b, x, r);
+    memcpy(r0, r, (size_t)n * sizeof(double));
+    memset(p, 0, (size_t)n * sizeof(double));
+    memset(v, 0, (size_t)n * sizeof(double));
+
+    double rho = 1.0, alpha = 1.0, om = 1.0;
+    int it = 0;
+    while (res > target && it < max_iter) {
+        double rho_new = dot(r0, r, n);
+        if (rho_new == 0.0 || om == 0.0) break; // interruption
+        double beta = (rho_new / rho) * (alpha / om);
+        for (int i = 0; i < n; ++i) {
+            p[i] = r[i] + beta * (p[i] - om * v[i]);
+            ph[i] = p[i] / diag[i];
+        }
+        apply_i_minus_a(A, ph, v);
+        double r0v = dot(r0, v, n);
+        if (r0v == 0.0) break;
+        alpha = rho_new / r0v;
+        for (int i = 0; i < n; ++i) s[i] = r[i] - alpha * v[i];
+        it++;
+
+        if (norm1(s, n) <= target) {
+            for (int i = 0; i < n; ++i) x[i] += alpha * ph[i];
+            res = residual_l1(A, b, x, r);
+            break;
+        }
+
+        for (int i = 0; i < n; ++i) sh[i] = s[i] / diag[i];
+        apply_i_minus_a(A, sh, t);
+        double tt = dot(t, t, n);
+        om = (tt > 0.0) ? dot(t, s, n) / tt : 0.0;
+        for (int i = 0; i < n; ++i) {
+            x[i] += alpha * ph[i] + om * sh[i];
+            r[i] = s[i] - om * t[i];
+        }
+        rho = rho_new;
+        res = norm1(r, n);
+    }
+
+    // Résidu vrai (le résidu récursif dérive en précision finie)
+    res = residual_l1(A, b, x, NULL);
+    free(work);
+    free(diag);
+    set_info(info, it, res, res <= target);
+    return res <= target;
+}
+
+/**
+ * @brief  BiCGSTAB redémarré depuis le meilleur itéré
+ *
+ * Sur les systèmes mal conditionnés (temps moyens d'une longue chaîne de
+ * naissance-mort), BiCGSTAB peut diverger après avoir progressé. Chaque
+ * cycle de restart pas repart du meilleur itéré connu ; la boucle s'arrête
+ * dès qu'un cycle n'améliore pas le résidu, et x reçoit le meilleur itéré.
+ *
+ * @param[in]     A         Matrice creuse n×n
+ * @param[in]     b         Second membre (taille n)
+ * @param[in,out] x         Itéré de départ, puis meilleur itéré (taille n)
+ * @param[in]     tol       Tolérance relative sur ||b - (I - A) x||_1
+ * @param[in]     max_iter  Nombre maximal d'itérations, tous cycles confondus
+ * @param[in]     restart   Itérations par cycle
+ * @param[out]    info      Bilan (peut être NULL)
+ *
+ * @return  1 si convergé, 0 sinon, -1 si un pivot 1 - A[i][i] est <= 0
+ */
+int sp_solve_bicgstab_restarted(const t_spmatrix *A, const double *b, double *x,
+                                double tol, int max_iter, int restart, t_solve_info *info) {
+    set_info(info, 0, 0.0, 0);
+    if (!A || A->n <= 0 || !b || !x || restart <= 0) return -1;
+
+    int n = A->n;
+    t_solve_info ci;
+    int rc = sp_solve_bicgstab(A, b, x, tol, 0, &ci); // résidu de l'itéré de départ
+    if (rc < 0) return -1;
+    double best_res = ci.residual;
+    int conv = ci.converged;
+    int iters = 0;
+
+    double *y = (double *)malloc((size_t)n * sizeof(double));
+    if (!y) {
+        perror("malloc(bicgstab_restarted)");
+        exit(EXIT_FAILURE);
+    }
+    while (!conv && iters < max_iter) {
+        memcpy(y, x, (size_t)n * sizeof(double));
+        int chunk = (max_iter - iters < restart) ? max_iter - iters : restart;
+        conv = (sp_solve_bicgstab(A, b, y, tol, chunk, &ci) == 1);
+        iters += ci.iters;
+        if (ci.residual >= best_res) {
+            conv = 0;
+            break;
+        }
+        best_res = ci.residual;
+        memcpy(x, y, (size_t)n * sizeof(double));
+        if (ci.iters == 0) break; // interruption immédiate : plus de progrès possible
+    }
+    free(y);
+
+    set_info(info, iters, best_res, conv);
+    return conv;
+}
@@ -1,17 +1,24 @@
 #include <stdio.h>      // printf, fprintf
 #include <stdlib.h>     // exit, strtof
-#include <string.h>     // strcmp
+#include <string.h>     // strcmp, memset
 
-#include "io.h"           // read_graph_from_file
+#include "io.h"           // read_graph_from_file, read_dist_starts
 #include "verify.h"       // verify_markov
 #include "mermaid.h"      // export_mermaid
 #include "graph.h"        // AdjList, graph_free
 #include "tarjan.h"       // tarjan_partition
-#include "hasse.h"        // build_class_links, remove_transitive_links
+#include "scc_parallel.h" // scc_partition_parallel
+#include "scc_pearce.h"   // scc_partition_pearce
+#include "utils.h"        // peak_rss_kb
+#include "hasse.h"        // build_class_links_weighted, remove_transitive_links
 #include "mermaid_hasse.h"// export_hasse_mermaid
-#include "markov_props.h" // markov_class_types, markov_is_irreducible...
+#include "markov_props.h" // t_class_props, markov_is_irreducible...
 #include "matrix.h"       // matrices + distributions
-#include "period.h"       // class_period
+#include "period.h"       // class_periods
+#include "stationary.h"   // stationary_solve
+#include "absorption.h"   // absorption_compute
+#include "hitting.h"      // hitting_times
+#include "limit.h"        // limit_build
 
 // Structure des options de la ligne de commande
 typedef struct {
@@ -22,11 +29,21 @@ typedef struct {
     float eps_converge;
     int   keep_transitive;
     int   matrix_power;       // 0 = pas d'affichage
-    int   converge_max_iter;  // pour diff(M^n, M^{n-1})
-    int   dist_start;         // 0 = désactivé, sinon sommet de départ
+    int   converge_max_iter;  // pour diff(M^n, M^{n-1}) (0 = pas de recherche)
+    int   converge_linear;    // 1 : un produit par itération au lieu des carrés successifs
+    int   do_limit;           // matrice limite par classes (--limit)
+    const char *dist_start;      // liste de sommets de départ "V[,V|A-B...]" (NULL = aucune)
+    const char *dist_start_file; // fichier de distributions initiales (NULL = aucun)
     int   dist_steps;         // nb d'étapes pour la distribution
     int   do_stationary;
     int   do_period;
+    const char *flow_weights; // poids des sommets pour le flux entre classes (NULL = aucun)
+    int   threads;            // nb de threads (lecture du fichier, CFC parallèles, produits de matrices)
+    const char *scc_algo;     // "tarjan", "pearce" ou "parallel"
+    t_stat_solver stat_solver; // solveur des distributions stationnaires
+    double sor_omega;          // relaxation du solveur "sor"
+    int   stat_max_iter;       // itérations max des solveurs stationnaires
+    const char *hitting_targets; // cibles "V[,V|A-B...]" des temps d'atteinte (NULL = aucun calcul)
 } Options;
 
 // Affiche l'aide courte du programme --help
@@ -34,35 +51,67 @@ static void usage(const char *prog) {
     fprintf(stderr,
         "Usage: %s [options]\n\n"
         "Options principales:\n"
-        "  --in FILE           Graphe d'entrée (format: N puis lignes 'from to proba')\n"
+        "  --in FILE           Graphe d'entrée (texte: N puis lignes 'from to proba', ou binaire .mgb)\n"
         "  --eps E             Tolérance Markov et convergences (def 0.01)\n"
         "  --out-graph FILE    Export Mermaid du graphe complet\n"
         "  --out-hasse FILE    Export Mermaid du diagramme de Hasse (classes)\n"
         "  --keep-transitive   Ne pas retirer les liens transitifs du Hasse\n"
-        "  --matrix-power K    Affiche la matrice M^K\n"
-        "  --converge-max N    Iter max pour diff(M^n, M^{n-1}) < eps (def 30)\n"
-        "  --dist-start V --dist-steps T   Distribution après T étapes depuis le sommet V\n"
+        "  --flow-weights FILE Poids des sommets ('V p V p ...') du flux entre classes (def : aucun flux)\n"
+        "  --matrix-power K    Affiche la matrice M^K (O(log K) produits)\n"
+        "  --converge-max N    Iter max pour diff(M^n, M^{n-1}) < eps (def 0 : désactivé ; validation de --limit)\n"
+        "  --converge-search S Recherche de n: squaring (def, O(log n) produits) ou linear (un produit par itération)\n"
+        "  --limit             Matrice limite de Cesàro par classes (stationnaires + absorption)\n"
+        "  --dist-start V[,V|A-B...] --dist-steps T   Distributions après T étapes depuis chaque sommet listé\n"
+        "  --dist-start-file FILE   Distributions initiales (une par ligne: 'V' ou 'V p V p ...')\n"
         "  --no-stationary     Ne pas calculer les distributions stationnaires par classe\n"
+        "  --stationary-solver S  Solveur des stationnaires: power (def), gth, gs, sor, bicgstab ou auto\n"
+        "  --sor-omega W       Relaxation du solveur sor, 0 < W < 2 (def 0.8)\n"
+        "  --stationary-max-iter N  Itérations max des solveurs stationnaires (def 10000)\n"
+        "  --hitting-times V[,V|A-B...]  Temps moyen d'atteinte de ces sommets depuis chaque sommet\n"
         "  --period            Calcule la période de chaque classe\n"
+        "  --threads N         Nombre de threads (lecture du fichier, CFC parallèles, produits de matrices) (def 1)\n"
+        "  --scc ALGO          Calcul des classes: tarjan (def), pearce (mémoire réduite) ou parallel (multi-thread, voir --threads)\n"
         "  --help              Afficher cette aide et quitter\n\n"
+        "Conversion au format binaire (.mgb, relu par --in):\n"
+        "  %s convert IN OUT.mgb [--threads N]\n\n"
         "Exemple:\n"
         "  %s --in data/exemple_valid_step3.txt --out-graph out/mermaid/graph.mmd --out-hasse out/mermaid/hasse.mmd --matrix-power 3 --period\n",
-        prog, prog);
+        prog, prog, prog);
 }
 
-// Puissance entière simple: out = M^k (k>=1)
-static void mx_power_int(const t_matrix *M, int k, t_matrix *out) {
-    if (!M || !M->a || M->n <= 0 || k < 1 || !out) return;
-    t_matrix acc = mx_zeros(M->n);
-    t_matrix tmp = mx_zeros(M->n);
-    mx_copy(M, &acc);
-    for (int step = 2; step <= k; ++step) {
-        mx_mul(&acc, M, &tmp);
-        mx_copy(&tmp, &acc);
-    }
-    mx_copy(&acc, out);
-    mx_free(&acc);
-    mx_free(&tmp);
+// Sous-commande "convert IN OUT [--threads N]" : réécrit un graphe au format binaire .mgb
+static int run_convert(int argc, char **argv) {
+    const char *in = NULL;
+    const char *out = NULL;
+    int threads = 1;
+    for (int i = 2; i < argc; ++i) {
+        if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (!in) {
+            in = argv[i];
+        } else if (!out) {
+            out = argv[i];
+        } else {
+            fprintf(stderr, "[ERR] Unknown or incomplete argument: %s\n", argv[i]);
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (!in || !out) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    AdjList g;
+    read_graph_from_file_mt(in, &g, threads);
+    int rc = write_graph_binary(&g, out);
+    if (rc == 0) {
+        printf("[OK] Conversion binaire (N=%d) -> %s\n", g.size, out);
+    } else {
+        fprintf(stderr, "[ERR] Échec de l'écriture binaire vers %s\n", out);
+    }
+    graph_free(&g);
+    return rc == 0 ? 0 : 1;
 }
 
 // Affiche les classes (SCC)
@@ -70,23 +119,274 @@ static void print_partition(const Partition *p) {
     printf("[Partition] %d classe(s)\n", p->count);
     for (int i = 0; i < p->count; ++i) {
         printf("  C%d: {", i + 1);
-        for (int j = 0; j < p->classes[i].count; ++j) {
+        SccClass c = scc_class(p, i);
+        for (int j = 0; j < c.count; ++j) {
             if (j) printf(", ");
-            printf("%d", p->classes[i].verts[j]);
+            printf("%d", c.verts[j]);
         }
         printf("}\n");
     }
 }
 
-// Affiche les liens Hasse (0-basé en interne, affichage 1-basé)
+// Affiche les liens Hasse (0-basé en interne, affichage 1-basé) et leurs agrégats
 static void print_links(const HasseLinkArray *links) {
     if (!links) return;
     printf("[Hasse] %d lien(s)\n", links->count);
     for (int i = 0; i < links->count; ++i) {
-        printf("  C%d -> C%d\n", links->links[i].from_class + 1, links->links[i].to_class + 1);
+        const HasseLink *l = &links->links[i];
+        printf("  C%d -> C%d", l->from_class + 1, l->to_class + 1);
+        if (links->weighted) {
+            printf(" (Σp=%.4f, %lld arc(s)", l->proba, (long long)l->edges);
+            if (links->has_flow) printf(", flux=%.6g", l->flow);
+            printf(")");
+        }
+        printf("\n");
     }
 }
 
+/**
+ * @brief  Affiche les sous-classes cycliques d'une classe périodique
+ *
+ * Tri par dénombrement des sommets selon cyc[v] : O(taille + période).
+ *
+ * @param[in] p    Partition en CFC
+ * @param[in] k    Indice de la classe
+ * @param[in] d    Période de la classe (> 1)
+ * @param[in] cyc  Sous-classe cyclique de chaque sommet (voir class_periods)
+ */
+static void print_cyclic_subclasses(const Partition *p, int k, int d, const int *cyc) {
+    SccClass c = scc_class(p, k);
+    int *start = calloc((size_t)d + 1, sizeof(int));
+    int *order = malloc((size_t)c.count * sizeof(int));
+    if (!start || !order) {
+        perror("malloc(subclasses)");
+        exit(EXIT_FAILURE);
+    }
+    for (int j = 0; j < c.count; ++j) start[cyc[c.verts[j]] + 1]++;
+    for (int r = 0; r < d; ++r) start[r + 1] += start[r];
+    for (int j = 0; j < c.count; ++j) order[start[cyc[c.verts[j]]]++] = c.verts[j];
+
+    // start[r] pointe désormais sur la fin de la sous-classe r
+    for (int r = 0, j = 0; r < d; ++r) {
+        printf("    sous-classe %d: {", r);
+        for (int first = 1; j < start[r]; ++j, first = 0) {
+            printf("%s%d", first ? "" : ", ", order[j]);
+        }
+        printf("}\n");
+    }
+    free(start);
+    free(order);
+}
+
+/**
+ * @brief  Calcule et affiche les temps moyens d'atteinte des cibles (--hitting-times)
+ *
+ * Une ligne par sommet : temps moyen, 0 pour une cible, "inf" avec la
+ * raison quand les cibles ne sont pas atteintes presque sûrement.
+ *
+ * @param[in]  targets  Liste "V[,V|A-B...]" des sommets cibles
+ * @param[in]  g        Graphe
+ * @param[in]  p        Partition en classes de g
+ */
+static void print_hitting_times(const char *targets, const AdjList *g, const Partition *p) {
+    int n = g->size;
+    unsigned char *is_target = calloc((size_t)n + 1, 1);
+    unsigned char *status = malloc((size_t)n + 1);
+    double *h = malloc(((size_t)n + 1) * sizeof(double));
+    if (!is_target || !status || !h) {
+        perror("malloc(hitting)");
+        exit(EXIT_FAILURE);
+    }
+    parse_vertex_set(targets, n, "--hitting-times", is_target);
+    int nb_targets = 0;
+    for (int v = 1; v <= n; ++v) nb_targets += is_target[v];
+
+    if (nb_targets == 0) {
+        fprintf(stderr, "[ERR] --hitting-times: aucune cible valide\n");
+    } else {
+        t_solve_info info;
+        int rc = hitting_times(g, p, is_target, HIT_TOL, HIT_MAX_ITER, h, status, &info);
+        printf("[Temps d'atteinte] %d cible(s) (%s, %d itération(s), résidu %.2e)\n", nb_targets,
+               rc == 1 ? "converge" : (rc == 0 ? "non convergé" : "système invalide"),
+               info.iters, info.residual);
+        for (int v = 1; v <= n; ++v) {
+            switch (status[v]) {
+            case HIT_TARGET:
+                printf("  %d: 0 (cible)\n", v);
+                break;
+            case HIT_FINITE:
+                printf("  %d: %.4f\n", v, h[v]);
+                break;
+            case HIT_UNREACHABLE:
+                printf("  %d: inf (aucune cible atteignable)\n", v);
+                break;
+            default:
+                printf("  %d: inf (cible atteinte avec probabilité < 1)\n", v);
+                break;
+            }
+        }
+    }
+    free(h);
+    free(status);
+    free(is_target);
+}
+
+/**
+ * @brief  Affiche les probabilités d'absorption des états d'une classe transitoire
+ *
+ * Une ligne par état : probabilité de finir dans chaque classe persistante
+ * atteignable (les cibles à probabilité nulle sont omises), suivie si
+ * demandé du nombre moyen de pas avant absorption.
+ *
+ * @param[in]  p           Partition
+ * @param[in]  k           Classe transitoire
+ * @param[in]  abs         Résultat de absorption_compute
+ * @param[in]  with_steps  1 pour afficher le temps moyen
+ */
+static void print_absorption_rows(const Partition *p, int k, const t_absorption *abs, int with_steps) {
+    SccClass c = scc_class(p, k);
+    for (int i = 0; i < c.count; ++i) {
+        int v = c.verts[i];
+        int row = abs->row_of[v];
+        printf("    %d:", v);
+        int first = 1;
+        for (int64_t e = abs->row_ptr[row]; e < abs->row_ptr[row + 1]; ++e) {
+            if (abs->prob[e] <= 0.0) continue;
+            printf("%s C%d %.4f", first ? "" : ",", abs->target_class[abs->tgt[e]] + 1, abs->prob[e]);
+            first = 0;
+        }
+        if (with_steps) printf(" ; temps moyen %.4f", abs->steps[row]);
+        printf("\n");
+    }
+}
+
+/**
+ * @brief  Affiche l'absorption depuis chaque état d'une classe transitoire
+ *
+ * Bilan de résolution de la classe, puis une ligne par état avec son
+ * nombre moyen de pas avant absorption.
+ *
+ * @param[in]  p    Partition
+ * @param[in]  k    Classe transitoire
+ * @param[in]  abs  Résultat de absorption_compute
+ */
+static void print_absorption(const Partition *p, int k, const t_absorption *abs) {
+    const t_solve_info *info = &abs->class_info[k];
+    printf("transitoire -> absorption (%s, %d balayage(s), résidu %.2e)\n",
+           info->converged ? "converge" : "non convergé", info->iters, info->residual);
+    print_absorption_rows(p, k, abs, 1);
+}
+
+/**
+ * @brief  Affiche la matrice limite de Cesàro sous forme factorisée
+ *
+ * Pi[i][j] = a(i, C) · pi_C[j] : la stationnaire de chaque classe
+ * persistante C (ligne commune à ses états, a = 1), puis a(i, C) pour
+ * chaque état transitoire i. O(n + entrées d'absorption), jamais n².
+ *
+ * @param[in]  p              Partition
+ * @param[in]  is_persistent  [p->count] 1 si la classe est persistante
+ * @param[in]  lim            Résultat de limit_build
+ */
+static void print_limit(const Partition *p, const int *is_persistent, const t_limit *lim) {
+    for (int k = 0; k < p->count; ++k) {
+        if (!is_persistent[k]) continue;
+        SccClass c = scc_class(p, k);
+        printf("  C%d: pi = [", k + 1);
+        for (int j = 0; j < c.count; ++j) {
+            printf("%s%d: %.4f", (j ? ", " : ""), c.verts[j], (double)lim->pi[c.verts[j]]);
+        }
+        printf("]\n");
+    }
+    for (int k = 0; k < p->count; ++k) {
+        if (is_persistent[k]) continue;
+        printf("  C%d: a(i, C) =\n", k + 1);
+        print_absorption_rows(p, k, &lim->abs, 0);
+    }
+}
+
+/**
+ * @brief  Lit les poids des sommets (première distribution du fichier)
+ *
+ * Même format que --dist-start-file : "V p V p ...". Les sommets absents
+ * ont un poids nul.
+ *
+ * @return  Tableau de n poids (à libérer), NULL si le fichier est illisible ou vide
+ */
+static float *read_flow_weights(const char *filename, int n) {
+    t_dist_starts ds;
+    dist_starts_init(&ds);
+    float *w = NULL;
+    if (read_dist_starts(filename, n, &ds) >= 0 && ds.count > 0) {
+        w = calloc((size_t)n, sizeof(float));
+        if (w) {
+            for (int64_t k = ds.ptr[0]; k < ds.ptr[1]; ++k) w[ds.vert[k] - 1] += ds.p[k];
+        }
+    }
+    dist_starts_free(&ds);
+    return w;
+}
+
+// Nombre de distributions propagées ensemble (bloc n×DIST_BLOCK)
+#define DIST_BLOCK 64
+
+/**
+ * @brief  Affiche les distributions après opt->dist_steps étapes
+ *
+ * Les distributions initiales (--dist-start, puis --dist-start-file) sont
+ * propagées par blocs de DIST_BLOCK : chaque étape lit S une fois par bloc.
+ *
+ * @param[in] opt  Options (dist_start, dist_start_file, dist_steps)
+ * @param[in] S    Matrice de transition creuse
+ * @param[in] n    Nombre de sommets
+ */
+static void print_distributions(const Options *opt, const t_spmatrix *S, int n) {
+    t_dist_starts ds;
+    dist_starts_init(&ds);
+    if (opt->dist_start) parse_dist_start_list(opt->dist_start, n, &ds);
+    if (opt->dist_start_file) read_dist_starts(opt->dist_start_file, n, &ds);
+
+    size_t len = (size_t)n * DIST_BLOCK;
+    float *P0 = malloc(len * sizeof(float));
+    float *Pt = malloc(len * sizeof(float));
+    if (!P0 || !Pt) {
+        perror("malloc");
+        free(P0);
+        free(Pt);
+        dist_starts_free(&ds);
+        return;
+    }
+
+    for (int first = 0; first < ds.count; first += DIST_BLOCK) {
+        int b = ds.count - first < DIST_BLOCK ? ds.count - first : DIST_BLOCK;
+        memset(P0, 0, (size_t)n * (size_t)b * sizeof(float));
+        for (int s = 0; s < b; ++s) {
+            for (int64_t k = ds.ptr[first + s]; k < ds.ptr[first + s + 1]; ++k) {
+                P0[(size_t)(ds.vert[k] - 1) * b + s] += ds.p[k];
+            }
+        }
+        dist_power_sp_block(P0, S, b, opt->dist_steps, Pt);
+
+        for (int s = 0; s < b; ++s) {
+            int64_t k = ds.ptr[first + s];
+            if (ds.ptr[first + s + 1] - k == 1 && ds.p[k] == 1.0f) {
+                printf("[Distribution] après %d étape(s) en partant de %d : [", opt->dist_steps, ds.vert[k]);
+            } else {
+                printf("[Distribution] après %d étape(s) depuis la distribution initiale #%d : [",
+                       opt->dist_steps, first + s + 1);
+            }
+            for (int i = 0; i < n; ++i) {
+                printf("%s%.4f", (i ? ", " : ""), (double)Pt[(size_t)i * b + s]);
+            }
+            printf("]\n");
+        }
+    }
+
+    free(P0);
+    free(Pt);
+    dist_starts_free(&ds);
+}
+
 // Parse les arguments de la ligne de commande
 static int parse_args(int argc, char **argv, Options *opt) {
     // valeurs par défaut
@@ -96,12 +396,22 @@ static int parse_args(int argc, char **argv, Options *opt) {
     opt->eps_markov      = 0.01f;
     opt->eps_converge    = 0.01f;
     opt->keep_transitive = 0;
+    opt->flow_weights    = NULL;
     opt->matrix_power    = 0;
-    opt->converge_max_iter = 30;
-    opt->dist_start      = 0;
+    opt->converge_max_iter = 0;
+    opt->converge_linear = 0;
+    opt->do_limit        = 0;
+    opt->dist_start      = NULL;
+    opt->dist_start_file = NULL;
     opt->dist_steps      = 0;
     opt->do_stationary   = 1;
     opt->do_period       = 0;
+    opt->threads         = 1;
+    opt->scc_algo        = "tarjan";
+    opt->stat_solver     = STAT_POWER;
+    opt->sor_omega       = 0.8;
+    opt->stat_max_iter   = 10000;
+    opt->hitting_targets = NULL;
 
     for (int i = 1; i < argc; ++i) {
         if (!strcmp(argv[i], "--in") && i + 1 < argc) {
@@ -115,18 +425,59 @@ static int parse_args(int argc, char **argv, Options *opt) {
             opt->out_hasse = argv[++i];
         } else if (!strcmp(argv[i], "--keep-transitive")) {
             opt->keep_transitive = 1;
+        } else if (!strcmp(argv[i], "--flow-weights") && i + 1 < argc) {
+            opt->flow_weights = argv[++i];
         } else if (!strcmp(argv[i], "--matrix-power") && i + 1 < argc) {
             opt->matrix_power = atoi(argv[++i]);
         } else if (!strcmp(argv[i], "--converge-max") && i + 1 < argc) {
             opt->converge_max_iter = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--converge-search") && i + 1 < argc) {
+            const char *mode = argv[++i];
+            if (strcmp(mode, "squaring") && strcmp(mode, "linear")) {
+                fprintf(stderr, "[ERR] Unknown convergence search: %s\n", mode);
+                usage(argv[0]);
+                return -1;
+            }
+            opt->converge_linear = !strcmp(mode, "linear");
+        } else if (!strcmp(argv[i], "--limit")) {
+            opt->do_limit = 1;
         } else if (!strcmp(argv[i], "--dist-start") && i + 1 < argc) {
-            opt->dist_start = atoi(argv[++i]);
+            opt->dist_start = argv[++i];
+        } else if (!strcmp(argv[i], "--dist-start-file") && i + 1 < argc) {
+            opt->dist_start_file = argv[++i];
         } else if (!strcmp(argv[i], "--dist-steps") && i + 1 < argc) {
             opt->dist_steps = atoi(argv[++i]);
         } else if (!strcmp(argv[i], "--no-stationary")) {
             opt->do_stationary = 0;
+        } else if (!strcmp(argv[i], "--stationary-solver") && i + 1 < argc) {
+            if (stationary_solver_parse(argv[++i], &opt->stat_solver) != 0) {
+                fprintf(stderr, "[ERR] Unknown stationary solver: %s\n", argv[i]);
+                usage(argv[0]);
+                return -1;
+            }
+        } else if (!strcmp(argv[i], "--sor-omega") && i + 1 < argc) {
+            opt->sor_omega = strtod(argv[++i], NULL);
+            if (opt->sor_omega <= 0.0 || opt->sor_omega >= 2.0) {
+                fprintf(stderr, "[ERR] --sor-omega must be in (0, 2): %s\n", argv[i]);
+                usage(argv[0]);
+                return -1;
+            }
+        } else if (!strcmp(argv[i], "--stationary-max-iter") && i + 1 < argc) {
+            opt->stat_max_iter = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--hitting-times") && i + 1 < argc) {
+            opt->hitting_targets = argv[++i];
         } else if (!strcmp(argv[i], "--period")) {
             opt->do_period = 1;
+        } else if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+            opt->threads = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--scc") && i + 1 < argc) {
+            opt->scc_algo = argv[++i];
+            if (strcmp(opt->scc_algo, "tarjan") && strcmp(opt->scc_algo, "pearce")
+                && strcmp(opt->scc_algo, "parallel")) {
+                fprintf(stderr, "[ERR] Unknown SCC algorithm: %s\n", opt->scc_algo);
+                usage(argv[0]);
+                return -1;
+            }
         } else if (!strcmp(argv[i], "--help") || !strcmp(argv[i], "-h")) {
             usage(argv[0]);
             return 0;
@@ -141,15 +492,21 @@ static int parse_args(int argc, char **argv, Options *opt) {
 
 // Programme principal (argc: nombre d'arguments, argv: liste des arguments)
 int main(int argc, char **argv) {
+    if (argc >= 2 && !strcmp(argv[1], "convert")) {
+        return run_convert(argc, argv);
+    }
+
     Options opt;
     int parse_ok = parse_args(argc, argv, &opt);
     if (parse_ok <= 0) {
         return parse_ok == 0 ? 0 : 1;
     }
 
+    mx_set_threads(opt.threads);
+
     // 1) Lecture du graphe depuis le fichier
     AdjList g;
-    read_graph_from_file(opt.infile, &g);
+    read_graph_from_file_mt(opt.infile, &g, opt.threads);
 
     // 2) Vérification Markov (sommes sortantes ~ 1)
     int ok = verify_markov(&g, opt.eps_markov);  // Retourne 1 si ok, 0 sinon
@@ -159,32 +516,52 @@ int main(int argc, char **argv) {
         printf("[WARN] Graphe NON valide (Markov) avec eps=%.4f — voir messages ci-dessus.\n", (double)opt.eps_markov);
     }
 
-    // 3) Matrice de transition (Partie 3.1)
-    t_matrix M = mx_from_adjlist(&g);
+    // 3) Matrice de transition (Partie 3.1) : creuse ; la forme dense n×n
+    //    n'est construite que pour les puissances de matrice
+    t_spmatrix S = spmx_from_adjlist(&g);
+    t_matrix M = mx_zeros(0);
+    if (opt.matrix_power > 0 || opt.converge_max_iter > 0) {
+        M = mx_from_adjlist(&g);
+    }
 
     // 4) Partition SCC (Tarjan) et liens de Hasse (Partie 2)
     Partition P;
     scc_init_partition(&P);
-    tarjan_partition(&g, &P);
+    long rss_before = peak_rss_kb();
+    if (!strcmp(opt.scc_algo, "parallel")) {
+        scc_partition_parallel(&g, &P, opt.threads);
+    } else if (!strcmp(opt.scc_algo, "pearce")) {
+        scc_partition_pearce(&g, &P);
+    } else {
+        tarjan_partition(&g, &P);
+    }
+    long rss_after = peak_rss_kb();
     print_partition(&P);
+    if (rss_after >= 0) {
+        printf("[Mémoire] pic RSS %ld Ko (+%ld Ko pendant les CFC, algorithme %s)\n",
+               rss_after, rss_after - rss_before, opt.scc_algo);
+    }
 
     HasseLinkArray links;
     hasse_init_links(&links);
-    build_class_links(&g, &P, &links);
+    float *flow_w = NULL;
+    if (opt.flow_weights) {
+        flow_w = read_flow_weights(opt.flow_weights, g.size);
+        if (!flow_w) fprintf(stderr, "[ERR] Poids de flux illisibles: %s\n", opt.flow_weights);
+    }
+    build_class_links_weighted(&g, &P, flow_w, &links);
+    free(flow_w);
     if (!opt.keep_transitive && P.count > 0) {
         remove_transitive_links(&links, P.count);
     }
     print_links(&links);
 
     // 5) Typage des classes et propriétés Markov (Partie 2.3)
+    // Table des propriétés de classes : une passe, puis requêtes en O(1)
     int nb_classes = P.count;
-    int *is_transient = NULL;
-    int *is_persistent = NULL;
-    if (nb_classes > 0) {
-        is_transient = calloc((size_t)nb_classes, sizeof(int));
-        is_persistent = calloc((size_t)nb_classes, sizeof(int));
-        markov_class_types(&links, nb_classes, is_transient, is_persistent);
-    }
+    t_class_props props;
+    markov_class_props_build(&P, &links, &props);
+    const int *is_persistent = props.is_persistent;
 
     printf("[Classes] transitoire/persistante:\n");
     for (int i = 0; i < nb_classes; ++i) {
@@ -197,7 +574,7 @@ int main(int argc, char **argv) {
     printf("[Absorbants] ");
     int found_abs = 0;
     for (int v = 1; v <= g.size; ++v) {
-        if (markov_is_absorbing_vertex(&P, &links, v)) {
+        if (markov_props_is_absorbing(&props, v)) {
             printf("%d ", v);
             found_abs = 1;
         }
@@ -221,7 +598,7 @@ int main(int argc, char **argv) {
         }
     }
 
-    // 7) Matrices : puissance fixée et convergence diff(M^n, M^(n-1)) < eps
+    // 7) Matrices : puissance fixée, limite par classes et convergence diff(M^n, M^(n-1)) < eps
     if (opt.matrix_power > 0) {
         t_matrix MP = mx_zeros(M.n);
         mx_power_int(&M, opt.matrix_power, &MP);
@@ -230,76 +607,120 @@ int main(int argc, char **argv) {
         mx_free(&MP);
     }
 
+    // Matrice limite par classes : une stationnaire par classe persistante
+    // et l'absorption des transitoires, sans puissance dense. power ne
+    // converge pas sur une classe périodique : auto le remplace ici.
+    t_limit lim;
+    memset(&lim, 0, sizeof(lim));
+    if (opt.do_limit) {
+        t_stat_solver solver = (opt.stat_solver == STAT_POWER) ? STAT_AUTO : opt.stat_solver;
+        int conv = limit_build(&g, &P, is_persistent, &S, solver, LIMIT_EPS, opt.stat_max_iter,
+                               opt.sor_omega, &lim);
+        printf("[Matrix] Limite de Cesàro par classes, Pi[i][j] = a(i, C) · pi_C[j] (solveur %s, %s) :\n",
+               stationary_solver_name(solver), conv ? "converge" : "non convergé");
+        print_limit(&P, is_persistent, &lim);
+    }
+
+    // Ancienne recherche dense, gardée pour valider la limite par classes
     if (opt.converge_max_iter > 0) {
         t_matrix Mc = mx_zeros(M.n);
         int steps = 0;
-        int conv = mx_power_until_diff(&M, opt.eps_converge, opt.converge_max_iter, &Mc, &steps);
-        printf("[Matrix] Recherche convergence diff(M^n, M^{n-1}) < %.4f (max %d itérations)\n",
-               (double)opt.eps_converge, opt.converge_max_iter);
+        int conv = opt.converge_linear
+                       ? mx_power_until_diff(&M, opt.eps_converge, opt.converge_max_iter, &Mc, &steps)
+                       : mx_power_until_diff_squaring(&M, opt.eps_converge, opt.converge_max_iter, &Mc, &steps);
+        printf("[Matrix] Recherche convergence diff(M^n, M^{n-1}) < %.4f (max %d itérations, %s)\n",
+               (double)opt.eps_converge, opt.converge_max_iter, opt.converge_linear ? "linéaire" : "carrés successifs");
         printf("  -> %s (n=%d)\n", conv == 1 ? "Atteint" : "Non atteint", steps);
+        if (opt.do_limit && conv == 1) {
+            printf("  -> écart max |M^n - limite| = %.2e\n", limit_max_diff(&lim, &Mc));
+        }
+        // M dense est déjà là : la limite développée n×n ne coûte pas plus
+        if (opt.do_limit) {
+            t_matrix L = mx_zeros(0);
+            limit_to_dense(&lim, &L);
+            printf("[Matrix] Limite de Cesàro développée :\n");
+            mx_print(&L);
+            mx_free(&L);
+        }
         mx_free(&Mc);
     }
 
-    // 8) Distribution après T étapes depuis un sommet donné
-    if (opt.dist_steps > 0 && opt.dist_start >= 1 && opt.dist_start <= g.size) {
-        float *pi0 = calloc((size_t)g.size, sizeof(float));
-        float *pit = calloc((size_t)g.size, sizeof(float));
-        if (pi0 && pit) {
-            pi0[opt.dist_start - 1] = 1.0f;
-            dist_power(pi0, &M, opt.dist_steps, pit);
-            printf("[Distribution] après %d étape(s) en partant de %d : [", opt.dist_steps, opt.dist_start);
-            for (int i = 0; i < g.size; ++i) {
-                printf("%s%.4f", (i ? ", " : ""), (double)pit[i]);
-            }
-            printf("]\n");
-        }
-        free(pi0);
-        free(pit);
+    // 8) Distributions après T étapes depuis les sommets / distributions donnés
+    if (opt.dist_steps > 0 && (opt.dist_start || opt.dist_start_file)) {
+        print_distributions(&opt, &S, g.size);
     }
 
     // 9) Distributions stationnaires par classe persistante (Partie 3.2)
     if (opt.do_stationary && nb_classes > 0) {
-        printf("[Stationnaire] Par classe (persistante => distribution limite, transitoire => 0)\n");
+        printf("[Stationnaire] Par classe (persistante => distribution limite, transitoire => absorption), solveur %s\n",
+               stationary_solver_name(opt.stat_solver));
+        // Absorption de toutes les classes transitoires : un système creux
+        // par classe, ses cibles atteignables résolues ensemble ; déjà
+        // calculée par --limit le cas échéant
+        t_absorption own;
+        memset(&own, 0, sizeof(own));
+        const t_absorption *abs = opt.do_limit ? &lim.abs : &own;
+        int has_transient = 0;
+        for (int k = 0; k < nb_classes; ++k) has_transient |= !is_persistent[k];
+        if (has_transient && !opt.do_limit &&
+            absorption_compute(&g, &P, is_persistent, ABSORB_TOL, ABSORB_MAX_ITER, &own) < 0) {
+            fprintf(stderr, "[WARN] Absorption : somme sortante > 1, système I - Q singulier\n");
+        }
         for (int k = 0; k < nb_classes; ++k) {
-            t_matrix sub = subMatrix(M, P, k);
             printf("  C%d: ", k + 1);
-            if (!is_persistent[k] || sub.n == 0) {
-                printf("transitoire -> [");
-                for (int j = 0; j < sub.n; ++j) {
-                    printf("%s0.0", (j ? ", " : ""));
-                }
-                printf("]\n");
-            } else {
-                float *pi = calloc((size_t)sub.n, sizeof(float));
-                int conv = stationary_distribution(&sub, opt.eps_converge, opt.converge_max_iter, pi);
-                printf("persistante -> [");
-                for (int j = 0; j < sub.n; ++j) {
-                    printf("%s%.4f", (j ? ", " : ""), (double)pi[j]);
-                }
-                printf("] (%s)\n", conv ? "converge" : "non convergé");
-                free(pi);
+            if (!is_persistent[k]) {
+                print_absorption(&P, k, abs);
+                continue;
             }
-            mx_free(&sub);
+            t_spmatrix sub = spmx_sub(&S, P, k);
+            float *pi = calloc((size_t)sub.n, sizeof(float));
+            t_solve_info info;
+            int conv = stationary_solve(&sub, opt.stat_solver, opt.eps_converge, opt.stat_max_iter,
+                                        opt.sor_omega, pi, &info);
+            printf("persistante -> [");
+            for (int j = 0; j < sub.n; ++j) {
+                printf("%s%.4f", (j ? ", " : ""), (double)pi[j]);
+            }
+            printf("] (%s, %d itération(s), résidu %.2e)\n", conv ? "converge" : "non convergé",
+                   info.iters, info.residual);
+            free(pi);
+            spmx_free(&sub);
         }
+        absorption_free(&own);
+    }
+    limit_free(&lim);
+
+    // 10) Temps moyens d'atteinte d'un ensemble de sommets
+    if (opt.hitting_targets) {
+        print_hitting_times(opt.hitting_targets, &g, &P);
     }
 
-    // 10) Période des classes (défi bonus Part 3.3)
+    // 11) Période des classes (défi bonus Part 3.3)
     if (opt.do_period && nb_classes > 0) {
-        printf("[Période] Par classe (via sous-matrice)\n");
+        printf("[Période] Par classe (parcours en largeur, sous-classes cycliques si période > 1)\n");
+        int *per = malloc((size_t)nb_classes * sizeof(int));
+        int *cyc = malloc(((size_t)g.size + 1) * sizeof(int));
+        if (!per || !cyc) {
+            perror("malloc(period)");
+            exit(EXIT_FAILURE);
+        }
+        class_periods(&g, &P, per, cyc);
         for (int k = 0; k < nb_classes; ++k) {
-            t_matrix sub = subMatrix(M, P, k);
-            int per = (sub.n > 0) ? class_period(&sub) : 0;
-            printf("  C%d: période = %d\n", k + 1, per);
-            mx_free(&sub);
+            printf("  C%d: période = %d\n", k + 1, per[k]);
+            if (per[k] > 1) {
+                print_cyclic_subclasses(&P, k, per[k], cyc);
+            }
         }
+        free(per);
+        free(cyc);
     }
 
     // Libération des ressources
-    free(is_transient);
-    free(is_persistent);
+    markov_class_props_free(&props);
     hasse_free_links(&links);
     scc_free_partition(&P);
     mx_free(&M);
+    spmx_free(&S);
     graph_free(&g);
 
     // Code de retour : 0 si Markov OK, 2 si non-Markov, 1 si erreur d’arguments (déjà géré).
@@ -7,8 +7,8 @@
 /**
  * @brief  Trouve l'index de la classe contenant un sommet donné
  *
- * Parcourt toutes les classes de la partition et recherche `vertex`
- * dans chacun des tableaux `verts[]`.
+ * Lit directement `class_of` quand la partition le tient à jour, sinon
+ * recherche `vertex` dans chaque classe.
  *
  * @param[in]  part    Partition de SCC (peut être NULL)
  * @param[in]  vertex  Identifiant du sommet recherché
@@ -20,10 +20,15 @@ static int find_class_of_vertex(const Partition *part, int vertex) {
         return -1;
     }
 
+    if (part->class_of) {
+        if (vertex <= 0 || vertex >= part->class_of_len) return -1;
+        return part->class_of[vertex];
+    }
+
     for (int cls_idx = 0; cls_idx < part->count; ++cls_idx) {
-        const SccClass *cls = &part->classes[cls_idx];
-        for (int j = 0; j < cls->count; ++j) {
-            if (cls->verts[j] == vertex) {
+        SccClass cls = scc_class(part, cls_idx);
+        for (int j = 0; j < cls.count; ++j) {
+            if (cls.verts[j] == vertex) {
                 return cls_idx; //Trouvé
             }
         }
@@ -148,10 +153,10 @@ int markov_is_absorbing_vertex(const Partition *part, const HasseLinkArray *link
         return 0;
     }
 
-    const SccClass *cls = &part->classes[cls_idx];
+    SccClass cls = scc_class(part, cls_idx);
 
     //Vérifier que la classe a un seul vertex, taille 1
-    if (cls->count != 1) {
+    if (cls.count != 1) {
         return 0;
     }
 
@@ -162,4 +167,112 @@ int markov_is_absorbing_vertex(const Partition *part, const HasseLinkArray *link
 
     //Les 3 conditions sont remplies
     return 1;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief  Construit la table des propriétés de classes
+ *
+ * Une passe sur les classes (tailles) et une passe sur les liens (degrés
+ * sortants, persistance). Les boucles de classe (from == to) sont ignorées,
+ * comme dans markov_class_types. Après construction, toutes les requêtes
+ * par sommet sont en O(1) au lieu de parcourir partition et liens.
+ *
+ * @param[in]  part   Partition en SCC (class_of utilisé comme vue)
+ * @param[in]  links  Liens entre classes (peut être NULL : tout est persistant)
+ * @param[out] out    Table résultat, à libérer via markov_class_props_free
+ *
+ * @note  Complexité en O(C + L), avec C classes et L liens.
+ */
+void markov_class_props_build(const Partition *part, const HasseLinkArray *links, t_class_props *out) {
+    out->nb_classes = 0;
+    out->size = NULL;
+    out->out_degree = NULL;
+    out->is_persistent = NULL;
+    out->class_of = NULL;
+    out->class_of_len = 0;
+    if (!part || part->count <= 0) {
+        return;
+    }
+
+    int C = part->count;
+    out->nb_classes = C;
+    out->size = (int*)malloc((size_t)C * sizeof(int));
+    out->out_degree = (int*)calloc((size_t)C, sizeof(int));
+    out->is_persistent = (int*)malloc((size_t)C * sizeof(int));
+    if (!out->size || !out->out_degree || !out->is_persistent) {
+        perror("malloc(class_props)");
+        exit(EXIT_FAILURE);
+    }
+    out->class_of = part->class_of;
+    out->class_of_len = part->class_of_len;
+
+    for (int k = 0; k < C; ++k) {
+        out->size[k] = part->class_offsets[k + 1] - part->class_offsets[k];
+    }
+
+    if (links) {
+        for (int i = 0; i < links->count; ++i) {
+            int from = links->links[i].from_class;
+            int to   = links->links[i].to_class;
+            if (from >= 0 && from < C && from != to) {
+                out->out_degree[from]++;
+            }
+        }
+    }
+
+    for (int k = 0; k < C; ++k) {
+        out->is_persistent[k] = (out->out_degree[k] == 0);
+    }
+}
+
+/**
+ * @brief  Libère une table de propriétés de classes
+ *
+ * @param[in,out] props  Table à libérer (remise à zéro)
+ */
+void markov_class_props_free(t_class_props *props) {
+    if (!props) return;
+    free(props->size);
+    free(props->out_degree);
+    free(props->is_persistent);
+    props->size = NULL;
+    props->out_degree = NULL;
+    props->is_persistent = NULL;
+    props->class_of = NULL;
+    props->class_of_len = 0;
+    props->nb_classes = 0;
+}
+
+/**
+ * @brief  Classe d'un sommet via la table
+ *
+ * @param[in]  props  Table des propriétés
+ * @param[in]  v      Sommet (1..N)
+ *
+ * @return  Index de classe (0..nb_classes-1), -1 si v est hors partition
+ */
+int markov_props_class_of(const t_class_props *props, int v) {
+    if (!props || !props->class_of || v <= 0 || v >= props->class_of_len) {
+        return -1;
+    }
+    return props->class_of[v];
+}
+
+/**
+ * @brief  Teste si un sommet est absorbant, en temps constant
+ *
+ * Mêmes conditions que markov_is_absorbing_vertex : classe de taille 1
+ * sans lien sortant.
+ *
+ * @param[in]  props  Table des propriétés
+ * @param[in]  v      Sommet à tester
+ *
+ * @return  1 si `v` est absorbant, sinon 0
+ */
+int markov_props_is_absorbing(const t_class_props *props, int v) {
+    int k = markov_props_class_of(props, v);
+    if (k < 0 || k >= props->nb_classes) {
+        return 0;
+    }
+    return props->size[k] == 1 && props->out_degree[k] == 0;
+}
@@ -1,9 +1,12 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
+#include <pthread.h>
 
 #include "scc.h"
 #include "matrix.h"
+#include "mx_kernels.h"
 
 /**
  * @brief  Alloue une matrice n×n initialisée à zéro
@@ -111,7 +114,7 @@ void mx_copy(const t_matrix *src, t_matrix *dst) {
  * @return  Matrice de transition correspondante
  */
 t_matrix mx_from_adjlist(const AdjList *g) {
-    if (!g || g->size <= 0 || !g->array) {
+    if (!g || g->size <= 0 || !g->offsets) {
         fprintf(stderr, "[matrix][ERR] Graphe invalide dans mx_from_adjlist\n");
         exit(EXIT_FAILURE);
     }
@@ -121,27 +124,118 @@ t_matrix mx_from_adjlist(const AdjList *g) {
 
     // Remplissage de la matrice à partir de la liste d'adjacence
     for (int vertexIndex = 0; vertexIndex < size; ++vertexIndex) {
-        List *adjacentList = &g->array[vertexIndex];
-        for (Cell *cell = adjacentList->head; cell != NULL; cell = cell->next) {
+        for (int64_t k = g->offsets[vertexIndex]; k < g->offsets[vertexIndex + 1]; ++k) {
             int from = vertexIndex + 1;   /* sommets dans le graphe : 1..n */
-            int to = cell->dest;          /* destination 1..n */
+            int to = g->dests[k];         /* destination 1..n */
             if (to < 1 || to > size) {
                 fprintf(stderr, "[matrix][ERR] Destination hors bornes %d (1..%d)\n", to, size);
                 mx_free(&matrix);
                 exit(EXIT_FAILURE);
             }
-            matrix.a[from - 1][to - 1] = cell->proba;
+            matrix.a[from - 1][to - 1] = g->probas[k];
         }
     }
 
     return matrix;
 }
 
+// Nombre de threads des produits denses (voir mx_set_threads)
+static int g_mx_threads = 1;
+
+// En dessous de cette taille, un produit est trop court pour amortir la création des threads
+#define MX_PAR_MIN_N 128
+
+// Plage de lignes de C = A × B calculée par un thread
+typedef struct {
+    const float *A, *B;
+    float       *C;
+    int          n;
+    int          row_begin, row_end;
+} t_mul_task;
+
+// Point d'entrée d'un thread de multiplication
+static void *mul_worker(void *arg) {
+    t_mul_task *t = (t_mul_task *)arg;
+    mx_kernel_mul(t->A, t->B, t->C, t->n, t->row_begin, t->row_end);
+    return NULL;
+}
+
+/**
+ * @brief  Fixe le nombre de threads des produits de matrices denses
+ *
+ * S'applique à mx_mul et donc à toutes les routines qui en dépendent
+ * (puissances, convergence, période). Chaque coefficient étant calculé par
+ * un seul thread, le résultat ne dépend pas du nombre de threads.
+ *
+ * @param[in] nthreads  Nombre de threads (<= 1 : calcul séquentiel)
+ */
+void mx_set_threads(int nthreads) {
+    g_mx_threads = nthreads < 1 ? 1 : nthreads;
+}
+
+/**
+ * @brief  Nombre de threads des produits de matrices denses
+ */
+int mx_get_threads(void) {
+    return g_mx_threads;
+}
+
+/**
+ * @brief  C = A × B par blocs de lignes répartis sur g_mx_threads threads
+ *
+ * Les blocs font un multiple de 4 lignes (hauteur du micro-noyau). Le
+ * premier bloc est calculé par l'appelant.
+ */
+static void mul_rows_parallel(const float *A, const float *B, float *C, int n) {
+    int nthreads = g_mx_threads;
+    if (nthreads > (n + 3) / 4) nthreads = (n + 3) / 4;
+    if (nthreads <= 1 || n < MX_PAR_MIN_N) {
+        mx_kernel_mul(A, B, C, n, 0, n);
+        return;
+    }
+
+    int rows = (((n + nthreads - 1) / nthreads) + 3) & ~3;
+    int nblocks = (n + rows - 1) / rows;
+    t_mul_task *tasks = (t_mul_task *)malloc((size_t)nblocks * sizeof(t_mul_task));
+    pthread_t *tids = (pthread_t *)malloc((size_t)nblocks * sizeof(pthread_t));
+    int *started = (int *)calloc((size_t)nblocks, sizeof(int));
+    if (!tasks || !tids || !started) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    // Noyau résolu avant le lancement des threads
+    mx_kernel_active();
+
+    for (int b = 0; b < nblocks; ++b) {
+        tasks[b].A = A;
+        tasks[b].B = B;
+        tasks[b].C = C;
+        tasks[b].n = n;
+        tasks[b].row_begin = b * rows;
+        tasks[b].row_end = (b + 1) * rows < n ? (b + 1) * rows : n;
+    }
+    for (int b = 1; b < nblocks; ++b) {
+        started[b] = (pthread_create(&tids[b], NULL, mul_worker, &tasks[b]) == 0);
+        if (!started[b]) mul_worker(&tasks[b]); // repli : calcul sur place
+    }
+    mul_worker(&tasks[0]);
+    for (int b = 1; b < nblocks; ++b) {
+        if (started[b]) pthread_join(tids[b], NULL);
+    }
+
+    free(started);
+    free(tids);
+    free(tasks);
+}
+
 /**
  * @brief  Multiplie deux matrices carrées A et B : C = A × B
  *
  * Les trois matrices doivent être de même taille. Si `C` n'est pas
  * correctement dimensionnée, elle est réallouée automatiquement.
+ * `C` doit être distincte de `A` et de `B`. Le calcul est réparti sur
+ * mx_get_threads() threads, avec un résultat identique au calcul séquentiel.
  *
  * @param[in]  A  Première matrice (à gauche)
  * @param[in]  B  Deuxième matrice (à droite)
@@ -160,16 +254,10 @@ void mx_mul(const t_matrix *A, const t_matrix *B, t_matrix *C) {
         *C = mx_zeros(size);
     }
 
-    //
-    for (int row = 0; row < size; ++row) {
-        for (int col = 0; col < size; ++col) {
-            float sum = 0.0f;
-            for (int kIndex = 0; kIndex < size; ++kIndex) {
-                sum += A->a[row][kIndex] * B->a[kIndex][col];
-            }
-            C->a[row][col] = sum;
-        }
-    }
+    // Noyau tuilé/vectorisé choisi à l'exécution (voir mx_kernels.c), par
+    // blocs de lignes sur plusieurs threads ; les données de chaque matrice
+    // sont contiguës à partir de a[0]
+    mul_rows_parallel(A->a[0], B->a[0], C->a[0], size);
 }
 
 /**
@@ -186,23 +274,16 @@ float mx_diff_abs1(const t_matrix *M, const t_matrix *N) {
         exit(EXIT_FAILURE);
     }
 
-    int size = M->n;
-    float totalDifference = 0.0f;
-
-    for (int row = 0; row < size; ++row) {
-        for (int col = 0; col < size; ++col) {
-            float delta = M->a[row][col] - N->a[row][col];
-            totalDifference += fabsf(delta);
-        }
-    }
-
-    return totalDifference;
+    // Noyau vectorisé, somme répartie sur MX_L1_LANES accumulateurs
+    return mx_kernel_diff_l1(M->a[0], N->a[0], (size_t)M->n * (size_t)M->n);
 }
 
 /**
  * @brief  Effectue une étape de distribution : pi1 = pi0 × M
  *
- * Les vecteurs `pi0` et `pi1` sont de taille `M->n`
+ * Les vecteurs `pi0` et `pi1` sont de taille `M->n` et distincts. M est
+ * parcourue ligne par ligne (accès contigus) ; chaque pi1[j] accumule ses
+ * termes dans l'ordre des lignes, comme la somme colonne par colonne.
  *
  * @param[in]  pi0  Distribution initiale (taille n)
  * @param[in]  M    Matrice de transition n×n (lignes = états de départ)
@@ -214,16 +295,9 @@ void dist_step(const float *pi0, const t_matrix *M, float *pi1) {
         exit(EXIT_FAILURE);
     }
 
-    int size = M->n;
-
-    // Calcul de pi1 = pi0 * M
-    for (int col = 0; col < size; ++col) {
-        float sum = 0.0f;
-        for (int row = 0; row < size; ++row) {
-            sum += pi0[row] * M->a[row][col];
-        }
-        pi1[col] = sum;
-    }
+    // Calcul de pi1 = pi0 * M, ligne par ligne (pi1 += pi0[row] * M[row,:]) :
+    // noyau vectorisé choisi à l'exécution, lignes de masse nulle ignorées
+    mx_kernel_vecmat(pi0, M->a[0], pi1, M->n);
 }
 
 /**
@@ -334,8 +408,8 @@ t_matrix subMatrix(t_matrix matrix, Partition part, int compo_index) {
     }
 
     // Récupération de la classe SCC correspondante
-    SccClass *cls = &part.classes[compo_index];
-    int m = cls->count;  // nombre de sommets dans la composante
+    SccClass cls = scc_class(&part, compo_index);
+    int m = cls.count;  // nombre de sommets dans la composante
 
     if (m <= 0) {
         // Classe vide -> sous-matrice vide
@@ -347,16 +421,16 @@ t_matrix subMatrix(t_matrix matrix, Partition part, int compo_index) {
 
     // Remplissage : projection des indices globaux vers la sous-matrice
     //
-    // cls->verts[k] contient des ids de sommets 1..N
+    // cls.verts[k] contient des ids de sommets 1..N
     // Les indices de la matrice globale matrix.a sont 0..N-1
     for (int i = 0; i < m; ++i) {
-        int gi = cls->verts[i] - 1;  // indice global (ligne)
+        int gi = cls.verts[i] - 1;  // indice global (ligne)
         if (gi < 0 || gi >= matrix.n) {
             continue;
         }
 
         for (int j = 0; j < m; ++j) {
-            int gj = cls->verts[j] - 1;  // indice global (colonne)
+            int gj = cls.verts[j] - 1;  // indice global (colonne)
             if (gj < 0 || gj >= matrix.n) {
                 continue;
             }
@@ -368,6 +442,69 @@ t_matrix subMatrix(t_matrix matrix, Partition part, int compo_index) {
     return sub;
 }
 
+// Échange le contenu de deux matrices (pointeurs seulement, sans copie)
+static void mx_swap(t_matrix *X, t_matrix *Y) {
+    t_matrix tmp = *X;
+    *X = *Y;
+    *Y = tmp;
+}
+
+/**
+ * @brief  Puissance entière par exponentiation binaire : out = M^k
+ *
+ * Les bits de k sont lus du poids fort au poids faible : à chaque bit,
+ * acc = acc², puis acc = acc × M si le bit vaut 1. Soit au plus
+ * 2·log2(k) produits au lieu de k-1. Deux tampons alloués une fois
+ * suffisent : chaque produit écrit dans le tampon libre, puis les deux sont
+ * échangés (aucune copie par étape). Pour k <= 3, les produits sont ceux de
+ * la multiplication successive (M·M)·M.
+ *
+ * @param[in]  M    Matrice de base (carrée)
+ * @param[in]  k    Puissance entière (k >= 0 ; M^0 = identité)
+ * @param[out] out  Matrice résultat (réallouée si nécessaire, distincte de M)
+ */
+void mx_power_int(const t_matrix *M, int k, t_matrix *out) {
+    if (!M || !M->a || M->n <= 0 || k < 0 || !out) {
+        fprintf(stderr, "[matrix][ERR] Paramètres invalides dans mx_power_int\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int size = M->n;
+    if (!out->a || out->n != size) {
+        mx_free(out);
+        *out = mx_zeros(size);
+    }
+
+    if (k == 0) {
+        for (int row = 0; row < size; ++row) {
+            for (int col = 0; col < size; ++col) {
+                out->a[row][col] = (row == col) ? 1.0f : 0.0f;
+            }
+        }
+        return;
+    }
+
+    // Tampons de travail : acc (résultat courant, porté par out) et tmp
+    t_matrix tmp = mx_zeros(size);
+    t_matrix acc = *out;
+    mx_copy(M, &acc);
+
+    int top = 30;
+    while (!((k >> top) & 1)) top--;
+    for (int bit = top - 1; bit >= 0; --bit) {
+        mx_mul(&acc, &acc, &tmp); // acc = acc²
+        mx_swap(&acc, &tmp);
+        if ((k >> bit) & 1) {
+            mx_mul(&acc, M, &tmp); // acc = acc × M
+            mx_swap(&acc, &tmp);
+        }
+    }
+
+    // Le résultat est dans acc : out le récupère, l'autre tampon est libéré
+    *out = acc;
+    mx_free(&tmp);
+}
+
 /**
  * @brief  Calcule M^k jusqu'à diff(M^k, M^(k-1)) < eps ou max_iter atteint.
  *
@@ -384,6 +521,7 @@ int mx_power_until_diff(const t_matrix *M, float eps, int max_iter, t_matrix *ou
         return -1;
     }
     if (eps < 0.0f) eps = -eps;
+    if (max_iter > MX_POWER_MAX_ITER) max_iter = MX_POWER_MAX_ITER;
 
     t_matrix Mk = mx_zeros(M->n);
     t_matrix Mk1 = mx_zeros(M->n);
@@ -396,7 +534,7 @@ int mx_power_until_diff(const t_matrix *M, float eps, int max_iter, t_matrix *ou
         mx_mul(&Mk, M, &Mk1);     // M^(k+1)
         float diff = mx_diff_abs1(&Mk, &Mk1);
         iter_used = k + 1; // puissance actuelle
-        mx_copy(&Mk1, &Mk); // préparation itération suivante
+        mx_swap(&Mk, &Mk1); // préparation itération suivante (sans copie)
 
         if (diff < eps) {
             converged = 1;
@@ -411,15 +549,104 @@ int mx_power_until_diff(const t_matrix *M, float eps, int max_iter, t_matrix *ou
     return converged;
 }
 
-// Norme L1 entre deux distributions de taille n
-static float dist_l1(const float *a, const float *b, int n) {
-    float s = 0.0f;
-    for (int i = 0; i < n; ++i) {
-        float d = a[i] - b[i];
-        if (d < 0) d = -d;
-        s += d;
+/**
+ * @brief  Même recherche que mx_power_until_diff, en O(log n) produits
+ *
+ * On cherche le premier k <= max_iter tel que d(k) = diff(M^k, M^(k+1))
+ * < eps. Pour M positive à lignes de somme <= 1, chaque ligne de
+ * (M^k - M^(k+1))·M a une norme L1 au plus égale à celle de la ligne de
+ * départ : d est décroissante et se prête à une recherche dichotomique.
+ *  1. Encadrement : carrés successifs M^(2^j), testés par un produit par M,
+ *     jusqu'au premier d(2^j) < eps (ou 2^(j+1) > max_iter).
+ *  2. Dichotomie : partant de lo = 2^(j-1), on essaie lo + 2^i pour i
+ *     décroissant, M^(lo + 2^i) = M^lo × M^(2^i) ; chaque carré est libéré
+ *     dès son niveau traité.
+ * Soit au plus 4·log2(n) produits au lieu de n, et log2(n) + 4 matrices.
+ * Les puissances ne sont pas obtenues par les mêmes produits : quand d(n)
+ * varie de moins que la dérive en float de n produits successifs, n peut
+ * différer d'une unité de celui de mx_power_until_diff (la recherche par
+ * carrés, en log2(n) produits, est alors la plus proche du calcul exact).
+ *
+ * @param[in]  M           Matrice de transition (taille N x N)
+ * @param[in]  eps         Tolérance de convergence
+ * @param[in]  max_iter    Nombre maximal d'itérations (au plus MX_POWER_MAX_ITER)
+ * @param[out] out         Matrice résultat M^n, comme mx_power_until_diff
+ * @param[out] iters_done  n, comme mx_power_until_diff (peut être NULL)
+ *
+ * @return 1 si convergence atteinte, 0 sinon, -1 en cas d'erreur
+ */
+int mx_power_until_diff_squaring(const t_matrix *M, float eps, int max_iter, t_matrix *out, int *iters_done) {
+    if (!M || !M->a || M->n <= 0 || !out || max_iter <= 0) {
+        return -1;
+    }
+    if (eps < 0.0f) eps = -eps;
+    // hi = max_iter + 1 sans débordement ; l'encadrement s'arrête à 2^29
+    if (max_iter > MX_POWER_MAX_ITER) max_iter = MX_POWER_MAX_ITER;
+
+    int size = M->n;
+    t_matrix sq[30];                 // sq[i] = M^(2^i), i <= 29
+    t_matrix next = mx_zeros(size);  // M^(c+1) du dernier essai c
+    t_matrix best = mx_zeros(size);  // M^(hi+1)
+    int nsq = 1;
+    sq[0] = mx_zeros(size);
+    mx_copy(M, &sq[0]);
+
+    // 1) Encadrement : d(lo) >= eps, et d(hi) < eps sauf si hi = max_iter+1
+    int lo = 0;
+    int hi = max_iter + 1;
+    for (;;) {
+        int p = 1 << (nsq - 1);
+        mx_mul(&sq[nsq - 1], M, &next);
+        if (mx_diff_abs1(&sq[nsq - 1], &next) < eps) {
+            hi = p;
+            mx_swap(&next, &best);
+            break;
+        }
+        lo = p;
+        if (p > max_iter / 2) break;
+        sq[nsq] = mx_zeros(size);
+        mx_mul(&sq[nsq - 1], &sq[nsq - 1], &sq[nsq]);
+        nsq++;
+    }
+
+    // 2) Dichotomie sur (lo, hi) : cur = M^lo, pris dans les carrés
+    t_matrix cur = mx_zeros(0);
+    int top = nsq - 1;
+    if (lo > 0) {
+        if (hi <= max_iter) mx_free(&sq[top--]); // M^hi : plus utile
+        mx_swap(&cur, &sq[top--]);
+    } else {
+        mx_free(&sq[top--]);
+    }
+    t_matrix cand = mx_zeros(0); // alloué au premier produit
+    for (int i = top; i >= 0; --i) {
+        int c = lo + (1 << i);
+        if (c < hi) {
+            mx_mul(&cur, &sq[i], &cand); // M^c
+            mx_mul(&cand, M, &next);     // M^(c+1)
+            if (mx_diff_abs1(&cand, &next) < eps) {
+                hi = c;
+                mx_swap(&next, &best);
+            } else {
+                lo = c;
+                mx_swap(&cur, &cand);
+            }
+        }
+        mx_free(&sq[i]);
     }
-    return s;
+
+    int converged = (hi <= max_iter);
+    if (!converged) {
+        mx_mul(&cur, M, &best); // lo = max_iter : M^(max_iter+1)
+    }
+
+    mx_copy(&best, out);
+    mx_free(&cand);
+    mx_free(&cur);
+    mx_free(&next);
+    mx_free(&best);
+    if (iters_done) *iters_done = converged ? hi + 1 : max_iter + 1;
+    return converged;
 }
 
 /**
@@ -450,16 +677,432 @@ int stationary_distribution(const t_matrix *MC, float eps, int max_iter, float *
     // distribution initiale uniforme
     for (int i = 0; i < n; ++i) cur[i] = 1.0f / (float)n;
 
+    // Une passe par itération : next = cur × MC et ||next - cur||_1
+    // ensemble, puis échange des tampons
     int converged = 0;
+    float d = 0.0f;
     for (int it = 0; it < max_iter; ++it) {
-        dist_step(cur, MC, next);
-        float d = dist_l1(cur, next, n);
-        for (int i = 0; i < n; ++i) cur[i] = next[i];
+        d = mx_kernel_vecmat_l1(cur, MC->a[0], next, n);
+        float *tmp = cur;
+        cur = next;
+        next = tmp;
+        if (d < eps) { converged = 1; break; }
+        if (!isfinite(d)) break; // somme sortante > 1 : la masse diverge
+    }
+
+    // Itéré non fini : non convergé, rien d'exploitable à rendre
+    for (int i = 0; i < n; ++i) pi_out[i] = isfinite(d) ? cur[i] : 0.0f;
+    free(cur);
+    free(next);
+    return converged;
+}
+
+// Matrices creuses (CSR)
+
+// Alloue une matrice creuse n×n pouvant contenir nnz coefficients
+static t_spmatrix spmx_alloc(int n, int64_t nnz) {
+    t_spmatrix S;
+    S.n = n;
+    S.nnz = 0;
+    S.row_ptr = (int64_t *)calloc((size_t)n + 1, sizeof(int64_t));
+    S.col = (int *)malloc((size_t)(nnz > 0 ? nnz : 1) * sizeof(int));
+    S.val = (float *)malloc((size_t)(nnz > 0 ? nnz : 1) * sizeof(float));
+    if (!S.row_ptr || !S.col || !S.val) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    return S;
+}
+
+/**
+ * @brief  Libère la mémoire occupée par une matrice creuse
+ *
+ * @param[in,out] S  Matrice à libérer (peut être NULL ou vide)
+ */
+void spmx_free(t_spmatrix *S) {
+    if (!S) {
+        return;
+    }
+    free(S->row_ptr);
+    free(S->col);
+    free(S->val);
+    S->row_ptr = NULL;
+    S->col = NULL;
+    S->val = NULL;
+    S->n = 0;
+    S->nnz = 0;
+}
+
+/**
+ * @brief  Construit la matrice de transitions creuse d'un graphe
+ *
+ * Même contenu que `mx_from_adjlist` sans la matrice dense n×n : mémoire en
+ * O(n + nnz). Si une arête i -> j apparaît plusieurs fois, seule la valeur
+ * retenue par `mx_from_adjlist` (la dernière parcourue) est gardée.
+ *
+ * @param[in] g  Graphe (Markov) déjà initialisé
+ *
+ * @return  Matrice de transition creuse correspondante
+ */
+t_spmatrix spmx_from_adjlist(const AdjList *g) {
+    if (!g || g->size <= 0 || !g->offsets) {
+        fprintf(stderr, "[matrix][ERR] Graphe invalide dans spmx_from_adjlist\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int size = g->size;
+    t_spmatrix S = spmx_alloc(size, g->nnz);
+
+    // slot[j] : position du coefficient (i, j) dans la ligne courante, -1 sinon
+    int64_t *slot = (int64_t *)malloc((size_t)size * sizeof(int64_t));
+    if (!slot) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int j = 0; j < size; ++j) slot[j] = -1;
+
+    int64_t pos = 0;
+    for (int row = 0; row < size; ++row) {
+        int64_t row_start = pos;
+        for (int64_t k = g->offsets[row]; k < g->offsets[row + 1]; ++k) {
+            int to = g->dests[k];
+            if (to < 1 || to > size) {
+                fprintf(stderr, "[matrix][ERR] Destination hors bornes %d (1..%d)\n", to, size);
+                exit(EXIT_FAILURE);
+            }
+            int col = to - 1;
+            if (slot[col] >= row_start) {
+                S.val[slot[col]] = g->probas[k]; // arête en double : écrase
+                continue;
+            }
+            slot[col] = pos;
+            S.col[pos] = col;
+            S.val[pos] = g->probas[k];
+            pos++;
+        }
+        S.row_ptr[row + 1] = pos;
+    }
+    S.nnz = pos;
+
+    free(slot);
+    return S;
+}
+
+/**
+ * @brief  Extrait la sous-matrice creuse d'une composante fortement connexe
+ *
+ * Équivalent creux de `subMatrix` : la ligne/colonne i de la sous-matrice
+ * correspond au sommet scc_class(&part, compo_index).verts[i].
+ *
+ * @param S           Matrice globale de transition creuse (taille N x N)
+ * @param part        Partition du graphe en composantes fortement connexes
+ * @param compo_index Indice de la composante dans part (0 .. part.count-1)
+ *
+ * @return  Sous-matrice creuse ; taille 0 si l'indice est invalide ou la classe vide
+ */
+t_spmatrix spmx_sub(const t_spmatrix *S, Partition part, int compo_index) {
+    t_spmatrix sub = {0, 0, NULL, NULL, NULL};
+    if (!S || compo_index < 0 || compo_index >= part.count) {
+        return sub;
+    }
+
+    SccClass cls = scc_class(&part, compo_index);
+    int m = cls.count;
+    if (m <= 0) {
+        return sub;
+    }
+
+    // local[v] : indice du sommet v dans la classe, -1 s'il n'y appartient pas
+    int *local = (int *)malloc((size_t)S->n * sizeof(int));
+    if (!local) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < S->n; ++v) local[v] = -1;
+
+    int64_t nnz = 0;
+    for (int i = 0; i < m; ++i) {
+        int gi = cls.verts[i] - 1;
+        if (gi < 0 || gi >= S->n) continue;
+        local[gi] = i;
+        nnz += S->row_ptr[gi + 1] - S->row_ptr[gi];
+    }
+
+    sub = spmx_alloc(m, nnz);
+    int64_t pos = 0;
+    for (int i = 0; i < m; ++i) {
+        int gi = cls.verts[i] - 1;
+        if (gi >= 0 && gi < S->n) {
+            for (int64_t k = S->row_ptr[gi]; k < S->row_ptr[gi + 1]; ++k) {
+                int j = local[S->col[k]];
+                if (j < 0) continue; // transition sortant de la classe
+                sub.col[pos] = j;
+                sub.val[pos] = S->val[k];
+                pos++;
+            }
+        }
+        sub.row_ptr[i + 1] = pos;
+    }
+    sub.nnz = pos;
+
+    free(local);
+    return sub;
+}
+
+/**
+ * @brief  Convertit une matrice creuse en matrice dense
+ *
+ * À réserver aux petites matrices (sous-matrices de classe, affichage).
+ *
+ * @param[in] S  Matrice creuse
+ *
+ * @return  Matrice dense équivalente (taille 0 si S est vide)
+ */
+t_matrix spmx_to_dense(const t_spmatrix *S) {
+    if (!S || S->n <= 0 || !S->row_ptr) {
+        return mx_zeros(0);
+    }
+
+    t_matrix matrix = mx_zeros(S->n);
+    for (int row = 0; row < S->n; ++row) {
+        for (int64_t k = S->row_ptr[row]; k < S->row_ptr[row + 1]; ++k) {
+            matrix.a[row][S->col[k]] = S->val[k];
+        }
+    }
+    return matrix;
+}
+
+// pi1 += pi0 × S : chaque ligne diffuse sa masse vers ses successeurs
+static void dist_scatter_sp(const float *pi0, const t_spmatrix *S, float *pi1) {
+    for (int row = 0; row < S->n; ++row) {
+        float p = pi0[row];
+        if (p == 0.0f) continue; // ligne sans masse : contribution nulle
+        for (int64_t k = S->row_ptr[row]; k < S->row_ptr[row + 1]; ++k) {
+            pi1[S->col[k]] += p * S->val[k];
+        }
+    }
+}
+
+/**
+ * @brief  Étape de distribution creuse : pi1 = pi0 × S
+ *
+ * Chaque ligne i diffuse pi0[i] vers ses successeurs. Les lignes étant
+ * parcourues dans l'ordre, chaque pi1[j] accumule ses termes dans le même
+ * ordre que `dist_step` : résultats identiques, en O(n + nnz).
+ *
+ * @param[in]  pi0  Distribution initiale (taille n)
+ * @param[in]  S    Matrice de transition creuse n×n
+ * @param[out] pi1  Distribution résultante (taille n, distincte de pi0)
+ */
+void dist_step_sp(const float *pi0, const t_spmatrix *S, float *pi1) {
+    if (!S || !S->row_ptr || S->n <= 0 || !pi0 || !pi1) {
+        fprintf(stderr, "[matrix][ERR] Paramètres invalides dans dist_step_sp\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int size = S->n;
+    for (int col = 0; col < size; ++col) {
+        pi1[col] = 0.0f;
+    }
+    dist_scatter_sp(pi0, S, pi1);
+}
+
+/**
+ * @brief  Calcule Pi_t = Pi_0 S^t par étapes creuses successives
+ *
+ * @param[in]  pi0  Distribution initiale (taille n)
+ * @param[in]  S    Matrice de transition creuse n×n
+ * @param[in]  t    Nombre d'étapes (t ≥ 0)
+ * @param[out] pit  Distribution après t étapes (taille n)
+ */
+void dist_power_sp(const float *pi0, const t_spmatrix *S, int t, float *pit) {
+    if (!S || !S->row_ptr || S->n <= 0 || !pi0 || !pit || t < 0) {
+        fprintf(stderr, "[matrix][ERR] Paramètres invalides dans dist_power_sp\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int size = S->n;
+    float *current = (float *)malloc((size_t)size * sizeof(float));
+    float *next = (float *)malloc((size_t)size * sizeof(float));
+    if (!current || !next) {
+        perror("malloc");
+        free(current);
+        free(next);
+        exit(EXIT_FAILURE);
+    }
+
+    for (int index = 0; index < size; ++index) {
+        current[index] = pi0[index];
+    }
+
+    for (int step = 0; step < t; ++step) {
+        dist_step_sp(current, S, next);
+
+        float *tmp = current;
+        current = next;
+        next = tmp;
+    }
+
+    for (int index = 0; index < size; ++index) {
+        pit[index] = current[index];
+    }
+
+    free(current);
+    free(next);
+}
+
+/**
+ * @brief  Étape creuse sur un bloc de b distributions : P1 = P0 × S
+ *
+ * Les blocs sont n×b, ligne par ligne : P[i*b + s] est la masse de l'état i
+ * dans la distribution s. Chaque coefficient de S est lu une seule fois pour
+ * les b distributions (ligne de b floats contiguë), au lieu d'une fois par
+ * distribution. Colonne par colonne, les termes sont accumulés dans l'ordre
+ * de `dist_step_sp` : résultats identiques.
+ *
+ * @param[in]  P0  Bloc de départ (n×b)
+ * @param[in]  S   Matrice de transition creuse n×n
+ * @param[in]  b   Nombre de distributions (b ≥ 1)
+ * @param[out] P1  Bloc résultat (n×b, distinct de P0)
+ */
+void dist_step_sp_block(const float *P0, const t_spmatrix *S, int b, float *P1) {
+    if (!S || !S->row_ptr || S->n <= 0 || !P0 || !P1 || b <= 0) {
+        fprintf(stderr, "[matrix][ERR] Paramètres invalides dans dist_step_sp_block\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int size = S->n;
+    memset(P1, 0, (size_t)size * (size_t)b * sizeof(float));
+
+    for (int row = 0; row < size; ++row) {
+        const float *x = P0 + (size_t)row * b;
+        int has_mass = 0;
+        for (int s = 0; s < b; ++s) {
+            if (x[s] != 0.0f) { has_mass = 1; break; }
+        }
+        if (!has_mass) continue; // ligne sans masse dans tout le bloc
+
+        for (int64_t k = S->row_ptr[row]; k < S->row_ptr[row + 1]; ++k) {
+            float v = S->val[k];
+            float *y = P1 + (size_t)S->col[k] * b;
+            for (int s = 0; s < b; ++s) {
+                y[s] += x[s] * v;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Calcule P_t = P_0 S^t pour un bloc de b distributions
+ *
+ * Équivalent de b appels à `dist_power_sp` (mêmes résultats), la matrice
+ * n'étant parcourue qu'une fois par étape pour tout le bloc.
+ *
+ * @param[in]  P0  Bloc de départ (n×b, voir dist_step_sp_block)
+ * @param[in]  S   Matrice de transition creuse n×n
+ * @param[in]  b   Nombre de distributions (b ≥ 1)
+ * @param[in]  t   Nombre d'étapes (t ≥ 0)
+ * @param[out] Pt  Bloc après t étapes (n×b)
+ */
+void dist_power_sp_block(const float *P0, const t_spmatrix *S, int b, int t, float *Pt) {
+    if (!S || !S->row_ptr || S->n <= 0 || !P0 || !Pt || b <= 0 || t < 0) {
+        fprintf(stderr, "[matrix][ERR] Paramètres invalides dans dist_power_sp_block\n");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t len = (size_t)S->n * (size_t)b;
+    float *current = (float *)malloc(len * sizeof(float));
+    float *next = (float *)malloc(len * sizeof(float));
+    if (!current || !next) {
+        perror("malloc");
+        free(current);
+        free(next);
+        exit(EXIT_FAILURE);
+    }
+
+    memcpy(current, P0, len * sizeof(float));
+    for (int step = 0; step < t; ++step) {
+        dist_step_sp_block(current, S, b, next);
+
+        float *tmp = current;
+        current = next;
+        next = tmp;
+    }
+    memcpy(Pt, current, len * sizeof(float));
+
+    free(current);
+    free(next);
+}
+
+/**
+ * @brief  Distribution stationnaire d'une matrice de transition creuse
+ *
+ * Même itération que `stationary_distribution` (départ uniforme, arrêt sur
+ * la norme L1 entre deux itérés), chaque étape coûtant O(n + nnz).
+ *
+ * @param SC       Matrice de transition creuse de la classe persistante
+ * @param eps      Tolérance de convergence
+ * @param max_iter Nombre maximal d'itérations
+ * @param pi_out   Tableau de sortie (taille SC->n)
+ *
+ * @return 1 si convergence atteinte, 0 sinon
+ */
+int stationary_distribution_sp(const t_spmatrix *SC, float eps, int max_iter, float *pi_out) {
+    return stationary_power_sp(SC, eps, max_iter, pi_out, NULL);
+}
+
+/**
+ * @brief  Itération de la puissance creuse, avec le nombre d'étapes effectuées
+ *
+ * @param SC         Matrice de transition creuse de la classe persistante
+ * @param eps        Tolérance de convergence
+ * @param max_iter   Nombre maximal d'itérations
+ * @param pi_out     Tableau de sortie (taille SC->n)
+ * @param iters_done Nombre d'étapes effectuées (optionnel, peut être NULL)
+ *
+ * @return 1 si convergence atteinte, 0 sinon
+ */
+int stationary_power_sp(const t_spmatrix *SC, float eps, int max_iter, float *pi_out, int *iters_done) {
+    if (iters_done) *iters_done = 0;
+    if (!SC || !SC->row_ptr || SC->n <= 0 || !pi_out || max_iter <= 0) {
+        return 0;
+    }
+    if (eps < 0.0f) eps = -eps;
+
+    int n = SC->n;
+    float *cur = (float *)malloc((size_t)n * sizeof(float));
+    float *next = (float *)malloc((size_t)n * sizeof(float));
+    if (!cur || !next) {
+        free(cur); free(next);
+        perror("malloc");
+        return 0;
+    }
+
+    // distribution initiale uniforme
+    for (int i = 0; i < n; ++i) cur[i] = 1.0f / (float)n;
+
+    // Deux passes par itération au lieu de trois : la diffusion dans next
+    // (remis à zéro), puis le résidu ||cur - next||_1 calculé en remettant
+    // à zéro l'ancien itéré, qui recevra la diffusion suivante
+    memset(next, 0, (size_t)n * sizeof(float));
+    int converged = 0;
+    int it = 0;
+    float d = 0.0f;
+    while (it < max_iter) {
+        dist_scatter_sp(cur, SC, next);
+        float *tmp = cur;
+        cur = next;
+        next = tmp;
+        it++;
+        d = mx_kernel_diff_l1_clear(cur, next, (size_t)n);
         if (d < eps) { converged = 1; break; }
+        if (!isfinite(d)) break; // somme sortante > 1 : la masse diverge
     }
 
-    for (int i = 0; i < n; ++i) pi_out[i] = cur[i];
+    // Itéré non fini : non convergé, rien d'exploitable à rendre
+    for (int i = 0; i < n; ++i) pi_out[i] = isfinite(d) ? cur[i] : 0.0f;
     free(cur);
     free(next);
+    if (iters_done) *iters_done = it;
     return converged;
 }
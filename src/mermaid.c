@@ -84,14 +84,14 @@ int export_mermaid(const AdjList *g, const char *outfile) {
         strncpy(from_id, get_id_alpha(from), sizeof(from_id));
         from_id[sizeof(from_id) - 1] = '\0';
 
-        for (Cell *c = g->array[from - 1].head; c; c = c->next) { // Parcourt la liste des voisins
-            int to = c->dest; // Nœud de destination
+        for (int64_t k = g->offsets[from - 1]; k < g->offsets[from]; ++k) { // Parcourt les voisins
+            int to = g->dests[k]; // Nœud de destination
             // Copier l'identifiant destination dans un buffer local
             char to_id[16];
             strncpy(to_id, get_id_alpha(to), sizeof(to_id));
             to_id[sizeof(to_id) - 1] = '\0';
 
-            fprintf(f, "%s -->|%.2f| %s\n", from_id, (double)c->proba, to_id); // Écrit la connexion avec la probabilité
+            fprintf(f, "%s -->|%.2f| %s\n", from_id, (double)g->probas[k], to_id); // Écrit la connexion avec la probabilité
         }
     }
 
@@ -62,6 +62,9 @@ static void write_class_label(FILE *f, int class_idx, const SccClass *cls) {
  *
  * Pour chaque lien (from_class, to_class), écrit une arête:
  *   Cfrom --> Cto
+ * ou, si les liens portent leurs agrégats (links->weighted), une arête
+ * étiquetée par la probabilité totale, le nombre d'arcs et le flux :
+ *   Cfrom -->|"Σp=0.500, 2 arc(s), flux=0.0125"| Cto
  *
  * @param[in]  f      Fichier déjà ouvert en écriture
  * @param[in]  links  Tableau des liens entre classes (HasseLinkArray)
@@ -73,7 +76,15 @@ static void write_links(FILE *f, const HasseLinkArray *links) {
         int from = links->links[i].from_class + 1; // affichage à partir de 1
         int to   = links->links[i].to_class + 1;
         // On écrit les liens tels quels ; si B retire la transitivité, on aura un Hasse net.
-        fprintf(f, "C%d --> C%d\n", from, to);
+        if (!links->weighted) {
+            fprintf(f, "C%d --> C%d\n", from, to);
+        } else if (!links->has_flow) {
+            fprintf(f, "C%d -->|\"Σp=%.3f, %lld arc(s)\"| C%d\n", from,
+                    links->links[i].proba, (long long)links->links[i].edges, to);
+        } else {
+            fprintf(f, "C%d -->|\"Σp=%.3f, %lld arc(s), flux=%.4g\"| C%d\n", from,
+                    links->links[i].proba, (long long)links->links[i].edges, links->links[i].flow, to);
+        }
     }
 }
 
@@ -125,8 +136,8 @@ int export_hasse_mermaid(const Partition *p, const HasseLinkArray *links, const
 
     // 4) Déclarer tous les nœuds Ck avec leurs labels "{...}"
     for (int k = 0; k < p->count; ++k) {
-        const SccClass *cls = &p->classes[k];
-        write_class_label(f, k, cls);
+        SccClass cls = scc_class(p, k);
+        write_class_label(f, k, &cls);
     }
     fputc('\n', f);
 
@@ -192,10 +203,10 @@ int export_partition_text(const Partition *p, const char *outfile) {
 
     // Pour chaque classe, lister ses sommets
     for (int k = 0; k < p->count; ++k) {
-        const SccClass *cls = &p->classes[k];
+        SccClass cls = scc_class(p, k);
         fprintf(f, "Class %d:", k + 1); // Affichage à partir de 1
-        for (int j = 0; j < cls->count; ++j) {
-            fprintf(f, " %d", cls->verts[j]);
+        for (int j = 0; j < cls.count; ++j) {
+            fprintf(f, " %d", cls.verts[j]);
         }
         fputc('\n', f);
     }
@@ -0,0 +1,549 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mx_kernels.h"
+
+// Noyaux SIMD x86 compilés à la demande (attribut target) : aucune option
+// de compilation globale n'est nécessaire, le choix se fait à l'exécution.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define MX_HAVE_X86_SIMD 1
+  #include <immintrin.h>
+#else
+  #define MX_HAVE_X86_SIMD 0
+#endif
+
+// Tuilage : un panneau de B de MX_KC lignes × MX_NC colonnes (256 Kio) reste
+// en cache pendant que les lignes de A défilent, par paquets de MX_MR lignes.
+#define MX_KC 128
+#define MX_NC 512
+#define MX_MR 4
+
+typedef void (*t_mul_fn)(const float *A, const float *B, float *C, int n, int r0, int r1);
+
+static int min_int(int a, int b) { return a < b ? a : b; }
+
+/**
+ * @brief  Noyau de référence : triple boucle i-j-k (ancien mx_mul)
+ *
+ * Parcourt B colonne par colonne : lent, conservé comme référence de
+ * résultats et de performances.
+ */
+static void mul_naive(const float *A, const float *B, float *C, int n, int r0, int r1) {
+    for (int row = r0; row < r1; ++row) {
+        for (int col = 0; col < n; ++col) {
+            float sum = 0.0f;
+            for (int k = 0; k < n; ++k) {
+                sum += A[(size_t)row * n + k] * B[(size_t)k * n + col];
+            }
+            C[(size_t)row * n + col] = sum;
+        }
+    }
+}
+
+/**
+ * @brief  Bloc scalaire : C[i0..i1][j0..j1] += A[i][k0..k1] × B[k0..k1][j]
+ *
+ * Boucle i-k-j : B et C sont parcourus ligne par ligne. Sert de noyau
+ * portable et traite les bords laissés par les noyaux SIMD.
+ */
+static void mul_block(const float *A, const float *B, float *C, int n,
+                      int i0, int i1, int j0, int j1, int k0, int k1) {
+    for (int i = i0; i < i1; ++i) {
+        float *c = C + (size_t)i * n;
+        const float *a = A + (size_t)i * n;
+        for (int k = k0; k < k1; ++k) {
+            float aik = a[k];
+            const float *b = B + (size_t)k * n;
+            for (int j = j0; j < j1; ++j) {
+                c[j] += aik * b[j];
+            }
+        }
+    }
+}
+
+// Met à zéro les lignes [r0, r1) de C avant accumulation
+static void zero_rows(float *C, int n, int r0, int r1) {
+    if (r1 > r0) memset(C + (size_t)r0 * n, 0, (size_t)(r1 - r0) * (size_t)n * sizeof(float));
+}
+
+// Noyau portable : même tuilage que les noyaux SIMD, boucles en C pur
+static void mul_portable(const float *A, const float *B, float *C, int n, int r0, int r1) {
+    zero_rows(C, n, r0, r1);
+    for (int jb = 0; jb < n; jb += MX_NC) {
+        int je = min_int(jb + MX_NC, n);
+        for (int kb = 0; kb < n; kb += MX_KC) {
+            int ke = min_int(kb + MX_KC, n);
+            mul_block(A, B, C, n, r0, r1, jb, je, kb, ke);
+        }
+    }
+}
+
+static float abs_f(float v) { return v < 0.0f ? -v : v; }
+
+/*
+ * Normes L1 : l'élément j est ajouté à l'accumulateur lanes[j % MX_L1_LANES]
+ * (j croissant), puis les voies sont sommées dans l'ordre. Un vecteur SIMD
+ * porte MX_L1_LANES / VL voies consécutives : tous les noyaux font les
+ * mêmes additions, dans le même ordre.
+ */
+
+// Référence scalaire : lanes[j % MX_L1_LANES] += |a[j] - b[j]| pour j dans
+// [j0, len) ; si clear n'est pas NULL (clear = b), b[j] est remis à zéro après lecture
+static void diff_l1_tail(const float *a, const float *b, size_t j0, size_t len, float *lanes, float *clear) {
+    for (size_t j = j0; j < len; ++j) {
+        lanes[j % MX_L1_LANES] += abs_f(a[j] - b[j]);
+        if (clear) clear[j] = 0.0f;
+    }
+}
+
+// Somme des voies, dans l'ordre
+static float l1_reduce(const float *lanes) {
+    float s = 0.0f;
+    for (int v = 0; v < MX_L1_LANES; ++v) s += lanes[v];
+    return s;
+}
+
+// Dernière ligne non nulle de x, -1 si x est nul
+static int last_nonzero(const float *x, int n) {
+    int row = n - 1;
+    while (row >= 0 && x[row] == 0.0f) row--;
+    return row;
+}
+
+/**
+ * @brief  Produit vecteur × matrice de référence : y[j] = Σ_i x[i]·A[i][j]
+ *
+ * Boucle colonne par colonne (ancien dist_step) : A est lue avec un pas de
+ * n floats, un défaut de cache par coefficient pour n grand. Si lanes
+ * n'est pas NULL, |y[j] - x[j]| y est accumulé dès que y[j] est calculé.
+ */
+static void vecmat_naive(const float *x, const float *A, float *y, int n, float *lanes) {
+    for (int col = 0; col < n; ++col) {
+        float sum = 0.0f;
+        for (int row = 0; row < n; ++row) {
+            sum += x[row] * A[(size_t)row * n + col];
+        }
+        y[col] = sum;
+        if (lanes) lanes[col % MX_L1_LANES] += abs_f(sum - x[col]);
+    }
+}
+
+/**
+ * @brief  Bloc scalaire : y[j0..n) += Σ_r x[rows[r]]·A[rows[r]][j], r croissant
+ *
+ * Sert de noyau portable (une ligne à la fois) et traite les colonnes
+ * restantes des noyaux SIMD. Si lanes n'est pas NULL (dernières lignes
+ * de x), y est définitif : |y[j] - x[j]| est accumulé au passage.
+ */
+static void vecmat_tail(const float *x, const float *A, float *y, int n,
+                        const int *rows, int nrows, int j0, float *lanes) {
+    for (int j = j0; j < n; ++j) {
+        float acc = y[j];
+        for (int r = 0; r < nrows; ++r) {
+            acc += x[rows[r]] * A[(size_t)rows[r] * n + j];
+        }
+        y[j] = acc;
+        if (lanes) lanes[j % MX_L1_LANES] += abs_f(acc - x[j]);
+    }
+}
+
+// Noyau portable : lignes de A parcourues de façon contiguë (forme axpy)
+static void vecmat_portable(const float *x, const float *A, float *y, int n, float *lanes) {
+    memset(y, 0, (size_t)n * sizeof(float));
+    int last = last_nonzero(x, n);
+    for (int row = 0; row <= last; ++row) {
+        if (x[row] == 0.0f) continue; // ligne sans masse : contribution nulle
+        vecmat_tail(x, A, y, n, &row, 1, 0, row == last ? lanes : NULL);
+    }
+    if (last < 0 && lanes) diff_l1_tail(y, x, 0, (size_t)n, lanes, NULL);
+}
+
+// Norme L1 portable (et naïve) : boucle scalaire sur les voies
+static void diff_l1_portable(const float *a, const float *b, size_t len, float *lanes, float *clear) {
+    diff_l1_tail(a, b, 0, len, lanes, clear);
+}
+
+#if MX_HAVE_X86_SIMD
+/*
+ * Génère un noyau SIMD : pour chaque tuile, un micro-noyau garde en registres
+ * MX_MR lignes × 2 vecteurs de C et parcourt k dans l'ordre croissant.
+ * Multiplication et addition restent séparées (pas de FMA) : chaque
+ * coefficient est calculé exactement comme par le noyau naïf.
+ */
+#define MX_DEFINE_SIMD_KERNEL(NAME, TARGET, VEC, VL, LOAD, STORE, ADD, MUL, SET1)         \
+__attribute__((target(TARGET)))                                                          \
+static void NAME(const float *A, const float *B, float *C, int n, int r0, int r1) {      \
+    zero_rows(C, n, r0, r1);                                                             \
+    for (int jb = 0; jb < n; jb += MX_NC) {                                              \
+        int je = min_int(jb + MX_NC, n);                                                 \
+        for (int kb = 0; kb < n; kb += MX_KC) {                                          \
+            int ke = min_int(kb + MX_KC, n);                                             \
+            int i = r0;                                                                  \
+            for (; i + MX_MR <= r1; i += MX_MR) {                                        \
+                const float *a0 = A + (size_t)i * n, *a1 = a0 + n;                       \
+                const float *a2 = a1 + n, *a3 = a2 + n;                                  \
+                int j = jb;                                                              \
+                for (; j + 2 * (VL) <= je; j += 2 * (VL)) {                              \
+                    float *c0 = C + (size_t)i * n + j, *c1 = c0 + n;                     \
+                    float *c2 = c1 + n, *c3 = c2 + n;                                    \
+                    VEC c00 = LOAD(c0), c01 = LOAD(c0 + (VL));                           \
+                    VEC c10 = LOAD(c1), c11 = LOAD(c1 + (VL));                           \
+                    VEC c20 = LOAD(c2), c21 = LOAD(c2 + (VL));                           \
+                    VEC c30 = LOAD(c3), c31 = LOAD(c3 + (VL));                           \
+                    for (int k = kb; k < ke; ++k) {                                      \
+                        const float *b = B + (size_t)k * n + j;                          \
+                        VEC b0 = LOAD(b), b1 = LOAD(b + (VL));                           \
+                        VEC x = SET1(a0[k]);                                             \
+                        c00 = ADD(c00, MUL(x, b0)); c01 = ADD(c01, MUL(x, b1));          \
+                        x = SET1(a1[k]);                                                 \
+                        c10 = ADD(c10, MUL(x, b0)); c11 = ADD(c11, MUL(x, b1));          \
+                        x = SET1(a2[k]);                                                 \
+                        c20 = ADD(c20, MUL(x, b0)); c21 = ADD(c21, MUL(x, b1));          \
+                        x = SET1(a3[k]);                                                 \
+                        c30 = ADD(c30, MUL(x, b0)); c31 = ADD(c31, MUL(x, b1));          \
+                    }                                                                    \
+                    STORE(c0, c00); STORE(c0 + (VL), c01);                               \
+                    STORE(c1, c10); STORE(c1 + (VL), c11);                               \
+                    STORE(c2, c20); STORE(c2 + (VL), c21);                               \
+                    STORE(c3, c30); STORE(c3 + (VL), c31);                               \
+                }                                                                        \
+                mul_block(A, B, C, n, i, i + MX_MR, j, je, kb, ke); /* colonnes restantes */ \
+            }                                                                            \
+            mul_block(A, B, C, n, i, r1, jb, je, kb, ke);           /* lignes restantes */   \
+        }                                                                                \
+    }                                                                                    \
+}
+
+MX_DEFINE_SIMD_KERNEL(mul_sse, "sse2", __m128, 4,
+                      _mm_loadu_ps, _mm_storeu_ps, _mm_add_ps, _mm_mul_ps, _mm_set1_ps)
+MX_DEFINE_SIMD_KERNEL(mul_avx2, "avx2", __m256, 8,
+                      _mm256_loadu_ps, _mm256_storeu_ps, _mm256_add_ps, _mm256_mul_ps, _mm256_set1_ps)
+MX_DEFINE_SIMD_KERNEL(mul_avx512, "avx512f", __m512, 16,
+                      _mm512_loadu_ps, _mm512_storeu_ps, _mm512_add_ps, _mm512_mul_ps, _mm512_set1_ps)
+
+/*
+ * Génère un noyau vecteur × matrice SIMD (forme axpy) : les lignes de masse
+ * non nulle sont regroupées par 4 et y n'est lu/écrit qu'une fois par
+ * groupe. Les contributions sont ajoutées ligne par ligne, dans l'ordre
+ * croissant : même résultat que le noyau naïf. Avec lanes, le groupe qui
+ * contient la dernière ligne non nulle accumule aussi |y - x| pendant
+ * qu'il écrit y (résidu de l'itération sans relire y ni x).
+ */
+#define MX_DEFINE_SIMD_VECMAT(NAME, TARGET, VEC, VL, LOAD, STORE, ADD, SUB, MUL, ABS, SET1) \
+__attribute__((target(TARGET)))                                                          \
+static void NAME##_rows(const float *x, const float *A, float *y, int n,                 \
+                        const int *rows, int nrows, float *lanes) {                      \
+    VEC res[MX_L1_LANES / (VL)];                                                         \
+    for (int v = 0; v < MX_L1_LANES / (VL); ++v) res[v] = SET1(0.0f);                    \
+    int j = 0;                                                                           \
+    if (nrows == 4) {                                                                    \
+        const float *a0 = A + (size_t)rows[0] * n, *a1 = A + (size_t)rows[1] * n;        \
+        const float *a2 = A + (size_t)rows[2] * n, *a3 = A + (size_t)rows[3] * n;        \
+        VEC x0 = SET1(x[rows[0]]), x1 = SET1(x[rows[1]]);                                \
+        VEC x2 = SET1(x[rows[2]]), x3 = SET1(x[rows[3]]);                                \
+        for (; j + (VL) <= n; j += (VL)) {                                               \
+            VEC acc = LOAD(y + j);                                                       \
+            acc = ADD(acc, MUL(x0, LOAD(a0 + j)));                                       \
+            acc = ADD(acc, MUL(x1, LOAD(a1 + j)));                                       \
+            acc = ADD(acc, MUL(x2, LOAD(a2 + j)));                                       \
+            acc = ADD(acc, MUL(x3, LOAD(a3 + j)));                                       \
+            STORE(y + j, acc);                                                           \
+            if (lanes) {                                                                 \
+                int v = (j / (VL)) % (MX_L1_LANES / (VL));                               \
+                res[v] = ADD(res[v], ABS(SUB(acc, LOAD(x + j))));                        \
+            }                                                                            \
+        }                                                                                \
+    } else {                                                                             \
+        const float *a0 = A + (size_t)rows[0] * n;                                       \
+        VEC x0 = SET1(x[rows[0]]);                                                       \
+        for (; j + (VL) <= n; j += (VL)) {                                               \
+            VEC acc = ADD(LOAD(y + j), MUL(x0, LOAD(a0 + j)));                           \
+            STORE(y + j, acc);                                                           \
+            if (lanes) {                                                                 \
+                int v = (j / (VL)) % (MX_L1_LANES / (VL));                               \
+                res[v] = ADD(res[v], ABS(SUB(acc, LOAD(x + j))));                        \
+            }                                                                            \
+        }                                                                                \
+    }                                                                                    \
+    if (lanes) {                                                                         \
+        for (int v = 0; v < MX_L1_LANES / (VL); ++v) STORE(lanes + v * (VL), res[v]);    \
+    }                                                                                    \
+    vecmat_tail(x, A, y, n, rows, nrows, j, lanes);                                      \
+}                                                                                        \
+static void NAME(const float *x, const float *A, float *y, int n, float *lanes) {        \
+    memset(y, 0, (size_t)n * sizeof(float));                                             \
+    int last = last_nonzero(x, n);                                                       \
+    int rows[4];                                                                         \
+    int nrows = 0;                                                                       \
+    for (int row = 0; row <= last; ++row) {                                              \
+        if (x[row] == 0.0f) continue; /* ligne sans masse : contribution nulle */        \
+        rows[nrows++] = row;                                                             \
+        if (nrows == 4) {                                                                \
+            NAME##_rows(x, A, y, n, rows, 4, row == last ? lanes : NULL);                \
+            nrows = 0;                                                                   \
+        }                                                                                \
+    }                                                                                    \
+    for (int r = 0; r < nrows; ++r) {                                                    \
+        NAME##_rows(x, A, y, n, &rows[r], 1, r == nrows - 1 ? lanes : NULL);             \
+    }                                                                                    \
+    if (last < 0 && lanes) diff_l1_tail(y, x, 0, (size_t)n, lanes, NULL);                      \
+}
+
+/*
+ * Génère un noyau de norme L1 ||a - b||_1 : chaque pas traite MX_L1_LANES
+ * éléments, un vecteur d'accumulateurs par tranche de VL voies. Avec
+ * clear (= b), b est remis à zéro dans la même passe.
+ */
+#define MX_DEFINE_SIMD_DIFF_L1(NAME, TARGET, VEC, VL, LOAD, STORE, ADD, SUB, ABS, SET1)   \
+__attribute__((target(TARGET)))                                                          \
+static void NAME(const float *a, const float *b, size_t len, float *lanes, float *clear) { \
+    VEC res[MX_L1_LANES / (VL)];                                                         \
+    const VEC zero = SET1(0.0f);                                                         \
+    for (int v = 0; v < MX_L1_LANES / (VL); ++v) res[v] = zero;                          \
+    size_t j = 0;                                                                        \
+    for (; j + MX_L1_LANES <= len; j += MX_L1_LANES) {                                   \
+        for (int v = 0; v < MX_L1_LANES / (VL); ++v) {                                   \
+            const size_t o = j + (size_t)v * (VL);                                       \
+            res[v] = ADD(res[v], ABS(SUB(LOAD(a + o), LOAD(b + o))));                    \
+            if (clear) STORE(clear + o, zero);                                           \
+        }                                                                                \
+    }                                                                                    \
+    for (int v = 0; v < MX_L1_LANES / (VL); ++v) STORE(lanes + v * (VL), res[v]);        \
+    diff_l1_tail(a, b, j, len, lanes, clear);                                            \
+}
+
+// Valeur absolue : bit de signe effacé (SSE, AVX2), _mm512_abs_ps en AVX-512F
+#define MX_ABS_SSE(v)  _mm_andnot_ps(_mm_set1_ps(-0.0f), (v))
+#define MX_ABS_AVX2(v) _mm256_andnot_ps(_mm256_set1_ps(-0.0f), (v))
+
+MX_DEFINE_SIMD_VECMAT(vecmat_sse, "sse2", __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_add_ps, _mm_sub_ps,
+                      _mm_mul_ps, MX_ABS_SSE, _mm_set1_ps)
+MX_DEFINE_SIMD_VECMAT(vecmat_avx2, "avx2", __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_add_ps,
+                      _mm256_sub_ps, _mm256_mul_ps, MX_ABS_AVX2, _mm256_set1_ps)
+MX_DEFINE_SIMD_VECMAT(vecmat_avx512, "avx512f", __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_add_ps,
+                      _mm512_sub_ps, _mm512_mul_ps, _mm512_abs_ps, _mm512_set1_ps)
+
+MX_DEFINE_SIMD_DIFF_L1(diff_l1_sse, "sse2", __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_add_ps, _mm_sub_ps,
+                       MX_ABS_SSE, _mm_set1_ps)
+MX_DEFINE_SIMD_DIFF_L1(diff_l1_avx2, "avx2", __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_add_ps,
+                       _mm256_sub_ps, MX_ABS_AVX2, _mm256_set1_ps)
+MX_DEFINE_SIMD_DIFF_L1(diff_l1_avx512, "avx512f", __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps,
+                       _mm512_add_ps, _mm512_sub_ps, _mm512_abs_ps, _mm512_set1_ps)
+#endif
+
+// Noyau courant (résolu au premier appel si MX_KERNEL_AUTO)
+static t_mx_kernel g_kernel = MX_KERNEL_AUTO;
+
+/**
+ * @brief  Indique si un noyau est utilisable sur la machine courante
+ *
+ * @param[in] k  Noyau demandé
+ *
+ * @return  1 si le noyau est compilé et supporté par le processeur, 0 sinon
+ */
+int mx_kernel_supported(t_mx_kernel k) {
+    switch (k) {
+        case MX_KERNEL_AUTO:
+        case MX_KERNEL_NAIVE:
+        case MX_KERNEL_PORTABLE:
+            return 1;
+#if MX_HAVE_X86_SIMD
+        case MX_KERNEL_SSE:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse2") != 0;
+        case MX_KERNEL_AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+        case MX_KERNEL_AVX512:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx512f") != 0;
+#endif
+        default:
+            return 0;
+    }
+}
+
+// Meilleur noyau disponible, du plus large au plus simple
+static t_mx_kernel best_kernel(void) {
+    const t_mx_kernel order[] = {MX_KERNEL_AVX512, MX_KERNEL_AVX2, MX_KERNEL_SSE};
+    for (size_t i = 0; i < sizeof(order) / sizeof(order[0]); ++i) {
+        if (mx_kernel_supported(order[i])) return order[i];
+    }
+    return MX_KERNEL_PORTABLE;
+}
+
+/**
+ * @brief  Impose le noyau utilisé par mx_kernel_mul (tests, benchmarks)
+ *
+ * @param[in] k  Noyau souhaité (MX_KERNEL_AUTO : meilleur disponible)
+ *
+ * @return  0 si succès, -1 si le noyau n'est pas supporté (choix inchangé)
+ */
+int mx_kernel_select(t_mx_kernel k) {
+    if ((int)k < 0 || (int)k >= (int)MX_KERNEL_COUNT || !mx_kernel_supported(k)) {
+        return -1;
+    }
+    g_kernel = (k == MX_KERNEL_AUTO) ? best_kernel() : k;
+    return 0;
+}
+
+/**
+ * @brief  Noyau utilisé par mx_kernel_mul (résout MX_KERNEL_AUTO)
+ */
+t_mx_kernel mx_kernel_active(void) {
+    if (g_kernel == MX_KERNEL_AUTO) {
+        g_kernel = best_kernel();
+    }
+    return g_kernel;
+}
+
+/**
+ * @brief  Nom lisible d'un noyau
+ */
+const char *mx_kernel_name(t_mx_kernel k) {
+    switch (k) {
+        case MX_KERNEL_AUTO:     return "auto";
+        case MX_KERNEL_NAIVE:    return "naive";
+        case MX_KERNEL_PORTABLE: return "portable";
+        case MX_KERNEL_SSE:      return "sse";
+        case MX_KERNEL_AVX2:     return "avx2";
+        case MX_KERNEL_AVX512:   return "avx512";
+        default:                 return "?";
+    }
+}
+
+/**
+ * @brief  Calcule les lignes [row_begin, row_end) de C = A × B
+ *
+ * Matrices n×n contiguës, ligne par ligne. C ne doit recouvrir ni A ni B.
+ * Des appels sur des plages de lignes disjointes peuvent s'exécuter en
+ * parallèle.
+ *
+ * @param[in]  A          Matrice de gauche
+ * @param[in]  B          Matrice de droite
+ * @param[out] C          Résultat (seules les lignes demandées sont écrites)
+ * @param[in]  n          Taille des matrices
+ * @param[in]  row_begin  Première ligne calculée
+ * @param[in]  row_end    Ligne de fin (exclue)
+ */
+void mx_kernel_mul(const float *A, const float *B, float *C, int n, int row_begin, int row_end) {
+    if (n <= 0 || row_begin >= row_end) {
+        return;
+    }
+
+    t_mul_fn fn = mul_portable;
+    switch (mx_kernel_active()) {
+        case MX_KERNEL_NAIVE:    fn = mul_naive;  break;
+#if MX_HAVE_X86_SIMD
+        case MX_KERNEL_SSE:      fn = mul_sse;    break;
+        case MX_KERNEL_AVX2:     fn = mul_avx2;   break;
+        case MX_KERNEL_AVX512:   fn = mul_avx512; break;
+#endif
+        default:                 fn = mul_portable; break;
+    }
+    fn(A, B, C, n, row_begin, row_end);
+}
+
+// Produit vecteur × matrice par le noyau courant (résidu accumulé dans lanes si non NULL)
+static void vecmat_dispatch(const float *x, const float *A, float *y, int n, float *lanes) {
+    switch (mx_kernel_active()) {
+        case MX_KERNEL_NAIVE:    vecmat_naive(x, A, y, n, lanes);    break;
+#if MX_HAVE_X86_SIMD
+        case MX_KERNEL_SSE:      vecmat_sse(x, A, y, n, lanes);      break;
+        case MX_KERNEL_AVX2:     vecmat_avx2(x, A, y, n, lanes);     break;
+        case MX_KERNEL_AVX512:   vecmat_avx512(x, A, y, n, lanes);   break;
+#endif
+        default:                 vecmat_portable(x, A, y, n, lanes); break;
+    }
+}
+
+/**
+ * @brief  Produit vecteur ligne × matrice : y = x × A
+ *
+ * Matrice n×n contiguë, ligne par ligne ; y doit être distinct de x. Le
+ * noyau choisi par mx_kernel_select parcourt A ligne par ligne (sauf le
+ * noyau naïf) et saute les lignes où x est nul.
+ *
+ * @param[in]  x  Vecteur ligne (taille n)
+ * @param[in]  A  Matrice n×n
+ * @param[out] y  Résultat (taille n)
+ * @param[in]  n  Taille
+ */
+void mx_kernel_vecmat(const float *x, const float *A, float *y, int n) {
+    if (n <= 0) {
+        return;
+    }
+    vecmat_dispatch(x, A, y, n, NULL);
+}
+
+/**
+ * @brief  Étape de puissance fusionnée : y = x × A et renvoie ||y - x||_1
+ *
+ * Même y que mx_kernel_vecmat ; le résidu est accumulé pendant l'écriture
+ * finale de y (dernière ligne non nulle de x), sans nouvelle passe sur x
+ * et y. Somme par voies comme mx_kernel_diff_l1.
+ *
+ * @param[in]  x  Vecteur ligne (taille n)
+ * @param[in]  A  Matrice n×n
+ * @param[out] y  Résultat (taille n, distinct de x)
+ * @param[in]  n  Taille
+ *
+ * @return  ||y - x||_1
+ */
+float mx_kernel_vecmat_l1(const float *x, const float *A, float *y, int n) {
+    float lanes[MX_L1_LANES] = {0.0f};
+    if (n <= 0) {
+        return 0.0f;
+    }
+    vecmat_dispatch(x, A, y, n, lanes);
+    return l1_reduce(lanes);
+}
+
+// Norme L1 par le noyau courant (b remis à zéro si clear = b)
+static float diff_l1_dispatch(const float *a, const float *b, size_t len, float *clear) {
+    float lanes[MX_L1_LANES] = {0.0f};
+    switch (mx_kernel_active()) {
+#if MX_HAVE_X86_SIMD
+        case MX_KERNEL_SSE:      diff_l1_sse(a, b, len, lanes, clear);      break;
+        case MX_KERNEL_AVX2:     diff_l1_avx2(a, b, len, lanes, clear);     break;
+        case MX_KERNEL_AVX512:   diff_l1_avx512(a, b, len, lanes, clear);   break;
+#endif
+        default:                 diff_l1_portable(a, b, len, lanes, clear); break;
+    }
+    return l1_reduce(lanes);
+}
+
+/**
+ * @brief  Norme L1 de la différence de deux tableaux : ||a - b||_1
+ *
+ * Somme sur MX_L1_LANES accumulateurs (élément j dans la voie j % 16),
+ * réduits dans l'ordre : même résultat pour tous les noyaux, plus précis
+ * qu'une somme séquentielle sur de longs tableaux.
+ *
+ * @param[in]  a    Premier tableau
+ * @param[in]  b    Second tableau
+ * @param[in]  len  Nombre d'éléments (ex. n*n pour deux matrices)
+ *
+ * @return  Σ |a[j] - b[j]|
+ */
+float mx_kernel_diff_l1(const float *a, const float *b, size_t len) {
+    return diff_l1_dispatch(a, b, len, NULL);
+}
+
+/**
+ * @brief  ||a - b||_1 puis b = 0, en une seule passe sur b
+ *
+ * Pour les itérations par diffusion (pi1 += pi0[i] · S[i][.]) : l'itéré
+ * précédent sert au résidu puis est remis à zéro pour recevoir l'étape
+ * suivante, au lieu d'une passe de mise à zéro et d'une passe de résidu.
+ *
+ * @param[in]     a    Itéré courant
+ * @param[in,out] b    Itéré précédent, remis à zéro (distinct de a)
+ * @param[in]     len  Nombre d'éléments
+ *
+ * @return  Σ |a[j] - b[j]|, même valeur que mx_kernel_diff_l1
+ */
+float mx_kernel_diff_l1_clear(const float *a, float *b, size_t len) {
+    return diff_l1_dispatch(a, b, len, b);
+}
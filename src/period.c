@@ -1,5 +1,6 @@
-#include "matrix.h" // Nécessaire pour t_matrix, mx_copy, mx_mul, mx_free
+#include "matrix.h" // Nécessaire pour t_matrix
 #include "period.h"
+#include "scc.h"
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -28,8 +29,10 @@ static int gcd(int a, int b) {
 /**
  * @brief Calcule la période d'une chaîne de Markov irréductible (une classe SCC).
  *
- * La période d est le PGCD de tous les exposants k pour lesquels une probabilité
- * de retour à l'état de départ est positive (M^k[i][i] > 0).
+ * Parcours en largeur depuis l'état 0 : niveau[j] = distance depuis 0. La
+ * période est le PGCD de niveau[i] + 1 - niveau[j] sur tous les arcs i -> j
+ * (M[i][j] > EPSILON) : tout cycle a une longueur multiple de ce PGCD, et
+ * le PGCD est atteint. O(n²) sur la matrice dense, sans aucun produit.
  *
  * @param[in] MC Matrice de transition (sous-matrice de la classe irréductible)
  *
@@ -40,76 +43,100 @@ int class_period(const t_matrix *MC) {
         return 0; // Gère le cas d'une matrice vide
     }
 
-    // Borne supérieure (2*n est un choix pratique et conservateur pour la plupart des cas)
-    // Elle limite le nombre d'itérations pour garantir la terminaison rapide.
-    const int max_power = 2 * MC->n;
     const int n = MC->n;
-    
-    // Mk stocke la matrice de transition à la puissance k (commence à M^1)
-    t_matrix Mk = (t_matrix){0};
-    mx_copy(MC, &Mk); // Mk = M^1
-    
-    // period_gcd stocke le PGCD mis à jour des exposants k observés
-    int period_gcd = 0; 
-
-    // --- Vérification pour k = 1 (La matrice est déjà M^1) ---
-    int diag_non_zero = 0;
-    for (int i = 0; i < n; i++) {
-        // Teste si la probabilité de retour après 1 étape est positive
-        if (Mk.a[i][i] > EPSILON) {
-            diag_non_zero = 1;
-            break;
+    int *level = (int *)malloc((size_t)n * sizeof(int));
+    int *queue = (int *)malloc((size_t)n * sizeof(int));
+    if (!level || !queue) {
+        perror("malloc(period)");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++) level[i] = -1;
+
+    int period_gcd = 0;
+    int head = 0, tail = 0;
+    level[0] = 0;
+    queue[tail++] = 0;
+    while (head < tail) {
+        int i = queue[head++];
+        for (int j = 0; j < n; j++) {
+            if (MC->a[i][j] <= EPSILON) continue;
+            if (level[j] < 0) {
+                level[j] = level[i] + 1;
+                queue[tail++] = j;
+            } else {
+                period_gcd = gcd(period_gcd, abs(level[i] + 1 - level[j]));
+            }
         }
     }
-    if (diag_non_zero) {
-        // Si retour possible en 1 étape, la période est au moins 1.
-        period_gcd = 1;
+
+    free(level);
+    free(queue);
+
+    // Aucun cycle (état isolé sans boucle) : période 1 par convention
+    return (period_gcd == 0) ? 1 : period_gcd;
+}
+
+/**
+ * @brief Période et sous-classes cycliques de toutes les classes d'une partition.
+ *
+ * Pour chaque classe, parcours en largeur depuis son premier sommet en ne
+ * suivant que les arcs internes à la classe (class_of), puis PGCD de
+ * niveau[u] + 1 - niveau[v] sur ces arcs. La sous-classe cyclique d'un
+ * sommet est son niveau modulo la période. Chaque arc est lu une seule
+ * fois : O(N + M) au total, aucune sous-matrice n'est construite.
+ *
+ * @param[in]  g         Graphe (liste d'adjacence CSR)
+ * @param[in]  p         Partition en CFC de g (class_of renseigné)
+ * @param[out] period    Tableau [p->count] : période de chaque classe (>= 1)
+ * @param[out] subclass  Tableau [g->size + 1] indexé par sommet, ou NULL
+ */
+void class_periods(const AdjList *g, const Partition *p, int *period, int *subclass) {
+    if (!g || !p || g->size <= 0 || p->count <= 0) return;
+
+    const int N = g->size;
+    int *level = (int *)malloc(((size_t)N + 1) * sizeof(int));
+    int *queue = (int *)malloc((size_t)N * sizeof(int));
+    if (!level || !queue) {
+        perror("malloc(periods)");
+        exit(EXIT_FAILURE);
     }
+    for (int v = 0; v <= N; v++) level[v] = -1;
 
-    // --- Itération pour k >= 2 (M^2, M^3, ...) ---
-    for (int k = 2; k <= max_power; k++) {
-        t_matrix Mk_next = (t_matrix){0};
-        
-        // Calcul de M^k = M^(k-1) * M
-        mx_mul(&Mk, MC, &Mk_next);
-        
-        // Libération de la matrice précédente (M^(k-1))
-        mx_free(&Mk);
-        Mk = Mk_next; // Mise à jour de Mk pour l'étape k
-
-        diag_non_zero = 0;
-        // Vérifie la diagonale de la nouvelle matrice M^k
-        for (int i = 0; i < n; i++) {
-            // Teste la probabilité de retour après k étapes
-            if (Mk.a[i][i] > EPSILON) {
-                diag_non_zero = 1;
-                break;
-            }
+    for (int k = 0; k < p->count; k++) {
+        SccClass c = scc_class(p, k);
+        if (c.count == 0) {
+            period[k] = 1;
+            continue;
         }
-        
-        if (diag_non_zero) {
-            // Un retour est possible après k étapes
-            if (period_gcd == 0) {
-                // Premier exposant trouvé, initialise le PGCD
-                period_gcd = k;
-            } else {
-                // Met à jour le PGCD avec l'exposant k actuel
-                period_gcd = gcd(period_gcd, k);
+
+        int period_gcd = 0;
+        int head = 0, tail = 0;
+        level[c.verts[0]] = 0;
+        queue[tail++] = c.verts[0];
+        while (head < tail) {
+            int u = queue[head++];
+            for (int64_t e = g->offsets[u - 1]; e < g->offsets[u]; e++) {
+                int w = g->dests[e];
+                if (w >= p->class_of_len || p->class_of[w] != k) continue;
+                if (level[w] < 0) {
+                    level[w] = level[u] + 1;
+                    queue[tail++] = w;
+                } else {
+                    period_gcd = gcd(period_gcd, abs(level[u] + 1 - level[w]));
+                }
             }
         }
-        
-        // Optimisation : si le PGCD atteint 1, la chaîne est apériodique.
-        if (period_gcd == 1) {
-            mx_free(&Mk);
-            return 1;
+
+        period[k] = (period_gcd == 0) ? 1 : period_gcd;
+        if (subclass) {
+            for (int i = 0; i < c.count; i++) {
+                subclass[c.verts[i]] = level[c.verts[i]] % period[k];
+            }
         }
     }
-    
-    mx_free(&Mk); // Libère la dernière matrice calculée
 
-    // Cas de la période 1 si aucun retour n'a été trouvé (chaîne apériodique dès le début).
-    // Pour une SCC, une période est toujours trouvée, mais cette ligne garantit une valeur >= 1.
-    return (period_gcd == 0) ? 1 : period_gcd;
+    free(level);
+    free(queue);
 }
 
 /**
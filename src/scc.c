@@ -71,60 +71,185 @@ void scc_add_vertex(SccClass *c, int v) {
  * @param[out] p  Partition à initialiser
  *
  * @pre  `p` non NULL
- * @post `p->classes == NULL`, `p->count == 0`, `p->capacity == 0`
+ * @post `p->count == 0`, aucun tableau alloué
  */
 void scc_init_partition(Partition *p) {
     if (!p) return;
-    p->classes = NULL;
+    p->members = NULL;
+    p->class_offsets = NULL;
+    p->class_of = NULL;
     p->count = 0;
     p->capacity = 0;
+    p->n_members = 0;
+    p->members_cap = 0;
+    p->class_of_len = 0;
 }
 
 /**
- * @brief  Ajoute une classe à la partition
+ * @brief  Agrandit class_of pour couvrir le sommet v (nouvelles cases à -1)
+ *
+ * @param[in,out] p  Partition
+ * @param[in]     v  Identifiant de sommet (1..N)
+ */
+static void grow_class_of(Partition *p, int v) {
+    if (v < p->class_of_len) return;
+    int newlen = p->class_of_len > 0 ? p->class_of_len * 2 : 16;
+    if (newlen <= v) newlen = v + 1;
+    p->class_of = (int*)xrealloc(p->class_of, (size_t)newlen * sizeof(int));
+    for (int i = p->class_of_len; i < newlen; ++i) p->class_of[i] = -1;
+    p->class_of_len = newlen;
+}
+
+/**
+ * @brief  Réserve la place d'une partition de n sommets
  *
- * Copie superficielle de la classe dans le tableau de la partition,
- * avec réallocation automatique si nécessaire.
+ * Alloue d'un coup 'members' et 'class_of' : un algorithme qui range
+ * les n sommets remplit ensuite la partition sans réallocation (hors
+ * class_offsets, doublé au besoin).
+ *
+ * @param[in,out] p  Partition initialisée par `scc_init_partition`
+ * @param[in]     n  Nombre de sommets du graphe
+ */
+void scc_reserve_partition(Partition *p, int n) {
+    if (!p || n <= 0) return;
+    if (p->members_cap < p->n_members + n) {
+        p->members_cap = p->n_members + n;
+        p->members = (int*)xrealloc(p->members, (size_t)p->members_cap * sizeof(int));
+    }
+    grow_class_of(p, n);
+}
+
+/**
+ * @brief  Ajoute un sommet à la classe en cours de construction
+ *
+ * La classe n'est visible qu'après `scc_close_class`.
  *
  * @param[in,out] p  Partition cible
- * @param[in]     c  Classe à ajouter (copie superficielle)
+ * @param[in]     v  Identifiant du sommet (1..N)
+ */
+void scc_push_member(Partition *p, int v) {
+    if (!p) return;
+    if (p->n_members >= p->members_cap) {
+        int newcap = p->members_cap > 0 ? p->members_cap * 2 : 16;
+        p->members = (int*)xrealloc(p->members, (size_t)newcap * sizeof(int));
+        p->members_cap = newcap;
+    }
+    p->members[p->n_members++] = v;
+}
+
+/**
+ * @brief  Ferme la classe en cours : sommets ajoutés depuis la précédente
  *
- * @pre  `p` non NULL
- * @note La propriété de `c.verts` est transférée à la partition; ne pas le libérer ensuite hors de la partition.
+ * Enregistre la fin de la classe dans class_offsets et renseigne
+ * class_of pour ses sommets. Une classe vide est permise.
+ *
+ * @param[in,out] p  Partition cible
  */
-void scc_add_class(Partition *p, SccClass c) {
+void scc_close_class(Partition *p) {
     if (!p) return;
     if (p->count >= p->capacity) {
         int newcap = p->capacity > 0 ? p->capacity * 2 : 4;
-        p->classes = (SccClass*)xrealloc(p->classes, (size_t)newcap * sizeof(SccClass));
+        p->class_offsets = (int*)xrealloc(p->class_offsets, ((size_t)newcap + 1) * sizeof(int));
+        if (p->capacity == 0) p->class_offsets[0] = 0;
         p->capacity = newcap;
     }
-    p->classes[p->count++] = c; // shallow copy (verts owned by class)
+    int k = p->count;
+    for (int i = p->class_offsets[k]; i < p->n_members; ++i) {
+        int v = p->members[i];
+        grow_class_of(p, v);
+        p->class_of[v] = k;
+    }
+    p->class_offsets[k + 1] = p->n_members;
+    p->count++;
 }
 
 /**
- * @brief  Libère une partition et ses classes
+ * @brief  Construit une partition à partir d'un label de classe par sommet
  *
- * Libère chaque tableau de sommets des classes, puis le tableau des
- * classes lui‑même, et remet la structure à zéro.
+ * Tri par dénombrement : les classes sortent dans l'ordre des labels,
+ * les sommets de chaque classe par ordre croissant. Aucune réallocation.
+ *
+ * @param[in,out] p         Partition vide (initialisée par `scc_init_partition`)
+ * @param[in]     label     label[v-1] dans 0..nclasses-1 pour v = 1..n
+ * @param[in]     n         Nombre de sommets
+ * @param[in]     nclasses  Nombre de classes
+ */
+void scc_partition_from_labels(Partition *p, const int *label, int n, int nclasses) {
+    if (!p || n <= 0 || nclasses <= 0) return;
+    scc_reserve_partition(p, n);
+    p->class_offsets = (int*)xrealloc(p->class_offsets, ((size_t)nclasses + 1) * sizeof(int));
+    p->capacity = nclasses;
+
+    int *off = p->class_offsets;
+    memset(off, 0, ((size_t)nclasses + 1) * sizeof(int));
+    for (int v = 0; v < n; ++v) off[label[v] + 1]++;
+    for (int c = 0; c < nclasses; ++c) off[c + 1] += off[c];
+
+    // Curseur d'écriture de chaque classe dans 'members'
+    int *cursor = (int*)xrealloc(NULL, (size_t)nclasses * sizeof(int));
+    memcpy(cursor, off, (size_t)nclasses * sizeof(int));
+    for (int v = 1; v <= n; ++v) {
+        int c = label[v - 1];
+        p->members[cursor[c]++] = v;
+        p->class_of[v] = c;
+    }
+    free(cursor);
+    p->count = nclasses;
+    p->n_members = n;
+}
+
+/**
+ * @brief  Ajoute une classe à la partition
+ *
+ * Copie les sommets de la classe à la suite de 'members' et ferme la
+ * classe. Le tableau `c.verts` est libéré.
+ *
+ * @param[in,out] p  Partition cible
+ * @param[in]     c  Classe à ajouter (construite par `scc_add_vertex`)
+ *
+ * @pre  `p` non NULL
+ * @note `c.verts` ne doit plus être utilisé après l'appel.
+ */
+void scc_add_class(Partition *p, SccClass c) {
+    if (!p) return;
+    for (int i = 0; i < c.count; ++i) scc_push_member(p, c.verts[i]);
+    scc_close_class(p);
+    free(c.verts);
+}
+
+/**
+ * @brief  Vue en lecture sur la classe k d'une partition
+ *
+ * Aucune copie : `verts` pointe dans 'members'. La vue est invalidée par
+ * toute modification ultérieure de la partition.
+ *
+ * @param[in]  p  Partition
+ * @param[in]  k  Indice de classe (0..count-1)
+ *
+ * @return  Classe k (`capacity == 0`)
+ */
+SccClass scc_class(const Partition *p, int k) {
+    SccClass c;
+    c.verts = p->members + p->class_offsets[k];
+    c.count = p->class_offsets[k + 1] - p->class_offsets[k];
+    c.capacity = 0;
+    return c;
+}
+
+/**
+ * @brief  Libère une partition
+ *
+ * Libère les trois tableaux et remet la structure à zéro.
  *
  * @param[in,out] p  Partition à libérer et remettre à zéro
  *
  * @pre  `p` non NULL
- * @post `p->classes == NULL`, `p->count == 0`, `p->capacity == 0`
+ * @post `p->count == 0`, aucun tableau alloué
  */
 void scc_free_partition(Partition *p) {
     if (!p) return;
-    if (p->classes) {
-        for (int i = 0; i < p->count; ++i) {
-            free(p->classes[i].verts);
-            p->classes[i].verts = NULL;
-            p->classes[i].count = 0;
-            p->classes[i].capacity = 0;
-        }
-        free(p->classes);
-    }
-    p->classes = NULL;
-    p->count = 0;
-    p->capacity = 0;
+    free(p->members);
+    free(p->class_offsets);
+    free(p->class_of);
+    scc_init_partition(p);
 }
@@ -0,0 +1,655 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "scc_parallel.h"
+#include "tarjan.h"
+
+/*
+ * CFC multi-thread, en phases séparées par la fin des threads :
+ *  1. transposée du graphe (prédécesseurs) ;
+ *  2. élagage : un sommet sans prédécesseur ou sans successeur actif est une
+ *     CFC à lui seul ; son retrait décrémente les degrés de ses voisins, en
+ *     cascade ;
+ *  3. avant-arrière depuis un pivot de grand degré : la CFC du pivot est
+ *     l'intersection des sommets atteints vers l'avant et vers l'arrière
+ *     (en pratique la grande classe des chaînes de Markov) ;
+ *  4. coloration pour le reste : chaque sommet prend le plus grand
+ *     identifiant qui l'atteint ; la CFC d'une racine r (couleur r) est
+ *     l'ensemble des sommets de couleur r qui atteignent r ;
+ *  5. Tarjan séquentiel sur le dernier reliquat (moins de SCC_PAR_SEQ_MAX
+ *     sommets).
+ * Une CFC est identifiée par un représentant : rep[v] = représentant de la
+ * classe de v, -1 tant que v n'est pas classé (sommet « actif »).
+ */
+
+// En dessous de ce nombre de sommets actifs, Tarjan séquentiel termine
+#define SCC_PAR_SEQ_MAX 4096
+// Nombre de sommets cédés d'un coup à la réserve partagée d'un parcours
+#define SCC_PAR_SHARE 64
+
+// Pile d'entiers extensible (propre à un thread)
+typedef struct {
+    int   *items;
+    size_t n, cap;
+} t_istack;
+
+// Réserve partagée d'un parcours parallèle (sommets restant à explorer)
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    t_istack        items;
+    int             busy;     // threads ayant du travail local
+    int             waiting;  // threads en attente de travail
+    int             done;     // réserve vide et plus aucun thread occupé
+} t_pool;
+
+typedef struct t_fb t_fb;
+typedef void (*t_phase_fn)(t_fb *F, int tid);
+
+// Contexte partagé par les phases
+struct t_fb {
+    const AdjList *g;
+    int      n;
+    int      nthreads;
+    int64_t *in_off;       // prédécesseurs de v : in_src[in_off[v] .. in_off[v+1]) (0..n-1)
+    int     *in_src;
+    int64_t *in_pos;       // curseurs de remplissage de la transposée
+    int     *rep;          // représentant de la classe de v (0..n-1), -1 si actif
+    int     *indeg;        // prédécesseurs actifs (boucles exclues)
+    int     *outdeg;       // successeurs actifs (boucles exclues)
+    int     *color;        // couleur de v (coloration)
+    unsigned char *mark;   // parcours : bit 1 = atteint vers l'avant, bit 2 = vers l'arrière
+    int64_t *tcount;       // compteurs par thread (sommets actifs)
+    int64_t *tscore;       // meilleur score de pivot par thread
+    int     *tpivot;       // pivot correspondant
+    // Paramètres de la phase en cours
+    int      pivot;        // sommet de départ du parcours
+    int      backward;     // 1 : parcours des prédécesseurs
+    int      changed;      // coloration : une couleur a changé pendant la passe
+    t_pool   pool;
+};
+
+// Paramètres d'un thread de phase
+typedef struct {
+    t_fb      *F;
+    int        tid;
+    t_phase_fn fn;
+} t_phase_task;
+
+// Termine le programme si une allocation a échoué
+static void *xmalloc(size_t sz) {
+    void *p = malloc(sz);
+    if (!p && sz != 0) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+static void istack_push(t_istack *s, int v) {
+    if (s->n == s->cap) {
+        s->cap = s->cap ? s->cap * 2 : 256;
+        int *p = (int *)realloc(s->items, s->cap * sizeof(int));
+        if (!p) {
+            perror("realloc");
+            exit(EXIT_FAILURE);
+        }
+        s->items = p;
+    }
+    s->items[s->n++] = v;
+}
+
+// Sommets [begin, end) traités par le thread tid dans les phases par plages
+static void thread_range(const t_fb *F, int tid, int *begin, int *end) {
+    *begin = (int)((int64_t)F->n * tid / F->nthreads);
+    *end = (int)((int64_t)F->n * (tid + 1) / F->nthreads);
+}
+
+/*
+ * Opérations partagées entre threads : atomiques (relâchées) si plusieurs
+ * threads travaillent, accès simples sinon (nettement moins coûteux).
+ */
+static int is_active(const t_fb *F, int v) {
+    return __atomic_load_n(&F->rep[v], __ATOMIC_RELAXED) < 0;
+}
+
+// Classe v comme CFC de représentant r ; retourne 0 si v était déjà classé
+static int claim(t_fb *F, int v, int r) {
+    if (F->nthreads == 1) {
+        if (F->rep[v] >= 0) return 0;
+        F->rep[v] = r;
+        return 1;
+    }
+    int expected = -1;
+    return __atomic_compare_exchange_n(&F->rep[v], &expected, r, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+// *p += 1 ; retourne l'ancienne valeur
+static int64_t fetch_inc(const t_fb *F, int64_t *p) {
+    if (F->nthreads == 1) return (*p)++;
+    return __atomic_fetch_add(p, 1, __ATOMIC_RELAXED);
+}
+
+// *p -= 1 ; retourne la nouvelle valeur
+static int dec_fetch(const t_fb *F, int *p) {
+    if (F->nthreads == 1) return --(*p);
+    return __atomic_sub_fetch(p, 1, __ATOMIC_RELAXED);
+}
+
+// *p |= bit ; retourne 1 si le bit était déjà posé
+static int test_and_set(const t_fb *F, unsigned char *p, unsigned char bit) {
+    if (F->nthreads == 1) {
+        int was = (*p & bit) != 0;
+        *p |= bit;
+        return was;
+    }
+    return (__atomic_fetch_or(p, bit, __ATOMIC_RELAXED) & bit) != 0;
+}
+
+// *p = max(*p, c) ; retourne 1 si *p a été augmenté
+static int store_max(const t_fb *F, int *p, int c) {
+    if (F->nthreads == 1) {
+        if (*p >= c) return 0;
+        *p = c;
+        return 1;
+    }
+    int cur = __atomic_load_n(p, __ATOMIC_RELAXED);
+    while (cur < c) {
+        if (__atomic_compare_exchange_n(p, &cur, c, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) return 1;
+    }
+    return 0;
+}
+
+static void *phase_worker(void *arg) {
+    t_phase_task *t = (t_phase_task *)arg;
+    t->fn(t->F, t->tid);
+    return NULL;
+}
+
+/**
+ * @brief  Exécute une phase sur F->nthreads threads (le thread 0 est l'appelant)
+ *
+ * Si un thread ne peut pas être créé, sa part est exécutée sur place après
+ * les autres : toutes les phases tolèrent un nombre quelconque de threads
+ * effectivement actifs.
+ */
+static void run_phase(t_fb *F, t_phase_fn fn) {
+    int nt = F->nthreads;
+    if (nt <= 1) {
+        fn(F, 0);
+        return;
+    }
+
+    t_phase_task *tasks = (t_phase_task *)xmalloc((size_t)nt * sizeof(t_phase_task));
+    pthread_t *tids = (pthread_t *)xmalloc((size_t)nt * sizeof(pthread_t));
+    int *started = (int *)calloc((size_t)nt, sizeof(int));
+    if (!started) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int t = 0; t < nt; ++t) {
+        tasks[t].F = F;
+        tasks[t].tid = t;
+        tasks[t].fn = fn;
+    }
+    for (int t = 1; t < nt; ++t) {
+        started[t] = (pthread_create(&tids[t], NULL, phase_worker, &tasks[t]) == 0);
+    }
+    fn(F, 0);
+    for (int t = 1; t < nt; ++t) {
+        if (started[t]) pthread_join(tids[t], NULL);
+        else fn(F, t); // repli : part du thread exécutée sur place
+    }
+
+    free(started);
+    free(tids);
+    free(tasks);
+}
+
+// Transposée, passe 1 : nombre de prédécesseurs de chaque sommet (dans in_off[w+1])
+static void phase_count_in(t_fb *F, int tid) {
+    int begin, end;
+    thread_range(F, tid, &begin, &end);
+    const AdjList *g = F->g;
+    for (int v = begin; v < end; ++v) {
+        for (int64_t k = g->offsets[v]; k < g->offsets[v + 1]; ++k) {
+            int w = g->dests[k] - 1;
+            if (w != v) fetch_inc(F, &F->in_off[w + 1]);
+        }
+    }
+}
+
+// Transposée, passe 2 : rangement des prédécesseurs (ordre indifférent)
+static void phase_fill_in(t_fb *F, int tid) {
+    int begin, end;
+    thread_range(F, tid, &begin, &end);
+    const AdjList *g = F->g;
+    for (int v = begin; v < end; ++v) {
+        for (int64_t k = g->offsets[v]; k < g->offsets[v + 1]; ++k) {
+            int w = g->dests[k] - 1;
+            if (w == v) continue;
+            int64_t slot = fetch_inc(F, &F->in_pos[w]);
+            F->in_src[slot] = v;
+        }
+    }
+}
+
+// Degrés vers les sommets actifs et nombre de sommets actifs de la plage
+static void phase_degrees(t_fb *F, int tid) {
+    int begin, end;
+    thread_range(F, tid, &begin, &end);
+    const AdjList *g = F->g;
+    int64_t active = 0;
+    for (int v = begin; v < end; ++v) {
+        if (F->rep[v] >= 0) continue;
+        active++;
+        int out = 0, in = 0;
+        for (int64_t k = g->offsets[v]; k < g->offsets[v + 1]; ++k) {
+            int w = g->dests[k] - 1;
+            if (w != v && F->rep[w] < 0) out++;
+        }
+        for (int64_t k = F->in_off[v]; k < F->in_off[v + 1]; ++k) {
+            if (F->rep[F->in_src[k]] < 0) in++;
+        }
+        F->outdeg[v] = out;
+        F->indeg[v] = in;
+    }
+    F->tcount[tid] = active;
+}
+
+/**
+ * @brief  Élagage en cascade des CFC triviales
+ *
+ * Chaque thread retire les sommets de sa plage sans prédécesseur ou sans
+ * successeur actif, puis propage : un voisin dont le degré tombe à 0 est
+ * retiré à son tour par le thread qui l'a décrémenté. tcount[tid] est
+ * diminué du nombre de sommets retirés par le thread.
+ */
+static void phase_trim(t_fb *F, int tid) {
+    int begin, end;
+    thread_range(F, tid, &begin, &end);
+    const AdjList *g = F->g;
+    t_istack work = {NULL, 0, 0};
+    int64_t removed = 0;
+
+    for (int v = begin; v < end; ++v) {
+        if (!is_active(F, v)) continue;
+        int in = __atomic_load_n(&F->indeg[v], __ATOMIC_RELAXED);
+        int out = __atomic_load_n(&F->outdeg[v], __ATOMIC_RELAXED);
+        if ((in == 0 || out == 0) && claim(F, v, v)) {
+            istack_push(&work, v);
+        }
+    }
+    while (work.n > 0) {
+        int v = work.items[--work.n];
+        removed++;
+        for (int64_t k = g->offsets[v]; k < g->offsets[v + 1]; ++k) {
+            int w = g->dests[k] - 1;
+            if (w == v || !is_active(F, w)) continue;
+            if (dec_fetch(F, &F->indeg[w]) == 0 && claim(F, w, w)) {
+                istack_push(&work, w);
+            }
+        }
+        for (int64_t k = F->in_off[v]; k < F->in_off[v + 1]; ++k) {
+            int u = F->in_src[k];
+            if (!is_active(F, u)) continue;
+            if (dec_fetch(F, &F->outdeg[u]) == 0 && claim(F, u, u)) {
+                istack_push(&work, u);
+            }
+        }
+    }
+    F->tcount[tid] -= removed;
+    free(work.items);
+}
+
+// Pivot de la plage : sommet actif maximisant indeg × outdeg
+static void phase_pick_pivot(t_fb *F, int tid) {
+    int begin, end;
+    thread_range(F, tid, &begin, &end);
+    int64_t best = -1;
+    int pivot = -1;
+    for (int v = begin; v < end; ++v) {
+        if (F->rep[v] >= 0) continue;
+        int64_t score = (int64_t)F->indeg[v] * F->outdeg[v];
+        if (score > best) {
+            best = score;
+            pivot = v;
+        }
+    }
+    F->tscore[tid] = best;
+    F->tpivot[tid] = pivot;
+}
+
+/**
+ * @brief  Parcours parallèle depuis F->pivot (avant, ou arrière si F->backward)
+ *
+ * Chaque thread explore en profondeur avec une pile locale ; quand des
+ * threads attendent, il cède SCC_PAR_SHARE sommets à la réserve partagée.
+ * Un sommet est pris une seule fois (bit de marque posé atomiquement). Le
+ * parcours arrière est restreint aux sommets atteints vers l'avant.
+ */
+static void phase_reach(t_fb *F, int tid) {
+    (void)tid;
+    const AdjList *g = F->g;
+    t_pool *P = &F->pool;
+    const unsigned char bit = F->backward ? 2 : 1;
+    t_istack local = {NULL, 0, 0};
+    int has_work = 0;
+
+    for (;;) {
+        if (local.n == 0) {
+            pthread_mutex_lock(&P->lock);
+            if (has_work) {
+                P->busy--;
+                has_work = 0;
+            }
+            while (P->items.n == 0 && P->busy > 0 && !P->done) {
+                __atomic_add_fetch(&P->waiting, 1, __ATOMIC_RELAXED); // lu hors verrou
+                pthread_cond_wait(&P->cond, &P->lock);
+                __atomic_sub_fetch(&P->waiting, 1, __ATOMIC_RELAXED);
+            }
+            if (P->items.n == 0) {
+                // Plus de travail nulle part : fin du parcours
+                P->done = 1;
+                pthread_cond_broadcast(&P->cond);
+                pthread_mutex_unlock(&P->lock);
+                break;
+            }
+            size_t take = P->items.n < SCC_PAR_SHARE ? P->items.n : SCC_PAR_SHARE;
+            for (size_t i = 0; i < take; ++i) {
+                istack_push(&local, P->items.items[--P->items.n]);
+            }
+            P->busy++;
+            has_work = 1;
+            pthread_mutex_unlock(&P->lock);
+        }
+
+        int v = local.items[--local.n];
+        if (F->backward) {
+            for (int64_t k = F->in_off[v]; k < F->in_off[v + 1]; ++k) {
+                int u = F->in_src[k];
+                if (F->rep[u] >= 0 || !(__atomic_load_n(&F->mark[u], __ATOMIC_RELAXED) & 1)) continue;
+                if (!test_and_set(F, &F->mark[u], bit)) istack_push(&local, u);
+            }
+        } else {
+            for (int64_t k = g->offsets[v]; k < g->offsets[v + 1]; ++k) {
+                int w = g->dests[k] - 1;
+                if (F->rep[w] >= 0) continue;
+                if (!test_and_set(F, &F->mark[w], bit)) istack_push(&local, w);
+            }
+        }
+
+        // Partage du travail avec les threads inoccupés
+        if (local.n > 2 * SCC_PAR_SHARE && __atomic_load_n(&P->waiting, __ATOMIC_RELAXED) > 0) {
+            pthread_mutex_lock(&P->lock);
+            for (int i = 0; i < SCC_PAR_SHARE; ++i) {
+                istack_push(&P->items, local.items[--local.n]);
+            }
+            pthread_cond_broadcast(&P->cond);
+            pthread_mutex_unlock(&P->lock);
+        }
+    }
+    free(local.items);
+}
+
+// Avant-arrière : les sommets atteints dans les deux sens forment la CFC du pivot
+static void phase_fb_assign(t_fb *F, int tid) {
+    int begin, end;
+    thread_range(F, tid, &begin, &end);
+    for (int v = begin; v < end; ++v) {
+        if (F->mark[v] == 3) F->rep[v] = F->pivot;
+        F->mark[v] = 0;
+    }
+}
+
+// Coloration : couleur initiale = identifiant
+static void phase_color_init(t_fb *F, int tid) {
+    int begin, end;
+    thread_range(F, tid, &begin, &end);
+    for (int v = begin; v < end; ++v) {
+        F->color[v] = v;
+    }
+}
+
+// Coloration : une passe de propagation du maximum le long des arcs
+static void phase_color_prop(t_fb *F, int tid) {
+    int begin, end;
+    thread_range(F, tid, &begin, &end);
+    const AdjList *g = F->g;
+    int changed = 0;
+    for (int v = begin; v < end; ++v) {
+        if (F->rep[v] >= 0) continue;
+        int c = __atomic_load_n(&F->color[v], __ATOMIC_RELAXED);
+        for (int64_t k = g->offsets[v]; k < g->offsets[v + 1]; ++k) {
+            int w = g->dests[k] - 1;
+            if (F->rep[w] >= 0) continue;
+            if (store_max(F, &F->color[w], c)) changed = 1;
+        }
+    }
+    if (changed) __atomic_store_n(&F->changed, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief  Coloration : CFC de chaque racine de la plage (couleur = identifiant)
+ *
+ * Parcours arrière depuis la racine restreint à sa couleur. Les couleurs
+ * étant disjointes, chaque sommet n'est visité que par un seul parcours.
+ */
+static void phase_color_roots(t_fb *F, int tid) {
+    int begin, end;
+    thread_range(F, tid, &begin, &end);
+    t_istack work = {NULL, 0, 0};
+    for (int r = begin; r < end; ++r) {
+        if (!is_active(F, r) || F->color[r] != r) continue;
+        __atomic_store_n(&F->rep[r], r, __ATOMIC_RELAXED);
+        istack_push(&work, r);
+        while (work.n > 0) {
+            int v = work.items[--work.n];
+            for (int64_t k = F->in_off[v]; k < F->in_off[v + 1]; ++k) {
+                int u = F->in_src[k];
+                if (F->color[u] != r || !is_active(F, u)) continue;
+                __atomic_store_n(&F->rep[u], r, __ATOMIC_RELAXED);
+                istack_push(&work, u);
+            }
+        }
+    }
+    free(work.items);
+}
+
+// Recalcule les degrés actifs, élague, et retourne le nombre de sommets actifs
+// (les degrés restent exacts après l'élagage, qui les décrémente)
+static int64_t trim_and_count(t_fb *F) {
+    run_phase(F, phase_degrees);
+    run_phase(F, phase_trim);
+    int64_t active = 0;
+    for (int t = 0; t < F->nthreads; ++t) active += F->tcount[t];
+    return active;
+}
+
+// Avant-arrière depuis le sommet actif de plus grand indeg × outdeg
+static void forward_backward(t_fb *F) {
+    run_phase(F, phase_pick_pivot);
+    int64_t best = -1;
+    for (int t = 0; t < F->nthreads; ++t) {
+        if (F->tpivot[t] >= 0 && F->tscore[t] > best) {
+            best = F->tscore[t];
+            F->pivot = F->tpivot[t];
+        }
+    }
+    if (best < 0) return;
+
+    for (int dir = 0; dir < 2; ++dir) {
+        F->backward = dir;
+        F->mark[F->pivot] |= (unsigned char)(dir ? 2 : 1);
+        F->pool.items.n = 0;
+        istack_push(&F->pool.items, F->pivot);
+        F->pool.busy = 0;
+        F->pool.waiting = 0;
+        F->pool.done = 0;
+        run_phase(F, phase_reach);
+    }
+    run_phase(F, phase_fb_assign);
+}
+
+// Une itération de coloration : propagation jusqu'au point fixe puis extraction
+static void coloring_step(t_fb *F) {
+    run_phase(F, phase_color_init);
+    do {
+        F->changed = 0;
+        run_phase(F, phase_color_prop);
+    } while (F->changed);
+    run_phase(F, phase_color_roots);
+}
+
+/**
+ * @brief  Termine séquentiellement : Tarjan sur le sous-graphe des sommets actifs
+ */
+static void finish_sequential(t_fb *F) {
+    const AdjList *g = F->g;
+    int *local = F->color; // indice local de chaque sommet actif (réutilise color)
+    int m = 0;
+    int64_t nnz = 0;
+    for (int v = 0; v < F->n; ++v) {
+        if (F->rep[v] >= 0) continue;
+        local[v] = m++;
+        nnz += g->offsets[v + 1] - g->offsets[v];
+    }
+    if (m == 0) return;
+
+    int *global = (int *)xmalloc((size_t)m * sizeof(int));
+    AdjList sub;
+    graph_init(&sub, m);
+    graph_reserve(&sub, nnz > 0 ? nnz : 1);
+    int64_t pos = 0;
+    for (int v = 0; v < F->n; ++v) {
+        if (F->rep[v] >= 0) continue;
+        int i = local[v];
+        global[i] = v;
+        sub.offsets[i] = pos;
+        for (int64_t k = g->offsets[v]; k < g->offsets[v + 1]; ++k) {
+            int w = g->dests[k] - 1;
+            if (F->rep[w] >= 0) continue;
+            sub.dests[pos] = local[w] + 1;
+            sub.probas[pos] = g->probas[k];
+            pos++;
+        }
+    }
+    sub.offsets[m] = pos;
+    sub.nnz = pos;
+
+    Partition P;
+    scc_init_partition(&P);
+    tarjan_partition(&sub, &P);
+    for (int i = 0; i < m; ++i) {
+        int c = P.class_of[i + 1];
+        F->rep[global[i]] = global[P.members[P.class_offsets[c]] - 1];
+    }
+
+    scc_free_partition(&P);
+    graph_free(&sub);
+    free(global);
+}
+
+/**
+ * @brief  Remplit la partition à partir des représentants
+ *
+ * Classes rangées par plus petit sommet, sommets croissants : résultat
+ * indépendant du nombre de threads et de l'ordre des parcours.
+ */
+static void build_partition(t_fb *F, Partition *out) {
+    int *idx = F->color;    // indice de classe de chaque représentant
+    int *label = F->indeg;  // indice de classe de chaque sommet
+    for (int v = 0; v < F->n; ++v) idx[v] = -1;
+
+    int count = 0;
+    for (int v = 0; v < F->n; ++v) {
+        int r = F->rep[v];
+        if (idx[r] < 0) idx[r] = count++;
+        label[v] = idx[r];
+    }
+    scc_partition_from_labels(out, label, F->n, count);
+}
+
+/**
+ * @brief  Calcule les CFC d'un graphe sur plusieurs threads
+ *
+ * Élagage parallèle des CFC triviales, avant-arrière depuis un pivot de
+ * grand degré, puis coloration tant qu'il reste plus de SCC_PAR_SEQ_MAX
+ * sommets ; Tarjan séquentiel termine. Même partition que
+ * `tarjan_partition` (ordre des classes différent, voir scc_parallel.h).
+ *
+ * @param[in]  g         Graphe d'entrée (liste d'adjacence)
+ * @param[out] out       Partition résultat, initialisée via `scc_init_partition`
+ * @param[in]  nthreads  Nombre de threads (<= 1 : un seul thread)
+ *
+ * @note  Mémoire : transposée du graphe (O(N + M)) et cinq tableaux de N entiers.
+ */
+void scc_partition_parallel(const AdjList *g, Partition *out, int nthreads) {
+    if (!g || g->size <= 0) return;
+
+    t_fb F;
+    memset(&F, 0, sizeof(F));
+    F.g = g;
+    F.n = g->size;
+    F.nthreads = nthreads < 1 ? 1 : nthreads;
+    if (F.nthreads > F.n) F.nthreads = F.n;
+
+    size_t n = (size_t)F.n;
+    F.in_off = (int64_t *)calloc(n + 1, sizeof(int64_t));
+    F.in_pos = (int64_t *)xmalloc(n * sizeof(int64_t));
+    F.rep = (int *)xmalloc(n * sizeof(int));
+    F.indeg = (int *)xmalloc(n * sizeof(int));
+    F.outdeg = (int *)xmalloc(n * sizeof(int));
+    F.color = (int *)xmalloc(n * sizeof(int));
+    F.mark = (unsigned char *)calloc(n, 1);
+    F.tcount = (int64_t *)xmalloc((size_t)F.nthreads * sizeof(int64_t));
+    F.tscore = (int64_t *)xmalloc((size_t)F.nthreads * sizeof(int64_t));
+    F.tpivot = (int *)xmalloc((size_t)F.nthreads * sizeof(int));
+    if (!F.in_off || !F.mark) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t v = 0; v < n; ++v) F.rep[v] = -1;
+    pthread_mutex_init(&F.pool.lock, NULL);
+    pthread_cond_init(&F.pool.cond, NULL);
+
+    // 1) Transposée
+    run_phase(&F, phase_count_in);
+    for (size_t v = 0; v < n; ++v) F.in_off[v + 1] += F.in_off[v];
+    memcpy(F.in_pos, F.in_off, n * sizeof(int64_t));
+    F.in_src = (int *)xmalloc((size_t)(F.in_off[n] > 0 ? F.in_off[n] : 1) * sizeof(int));
+    run_phase(&F, phase_fill_in);
+    free(F.in_pos);
+    F.in_pos = NULL;
+
+    // 2) Élagage, 3) avant-arrière, 4) coloration
+    int64_t active = trim_and_count(&F);
+    if (active > SCC_PAR_SEQ_MAX) {
+        forward_backward(&F);
+        active = trim_and_count(&F);
+    }
+    while (active > SCC_PAR_SEQ_MAX) {
+        coloring_step(&F);
+        active = trim_and_count(&F);
+    }
+
+    // 5) Reliquat séquentiel, puis partition
+    finish_sequential(&F);
+    build_partition(&F, out);
+
+    pthread_cond_destroy(&F.pool.cond);
+    pthread_mutex_destroy(&F.pool.lock);
+    free(F.pool.items.items);
+    free(F.in_off);
+    free(F.in_src);
+    free(F.rep);
+    free(F.indeg);
+    free(F.outdeg);
+    free(F.color);
+    free(F.mark);
+    free(F.tcount);
+    free(F.tscore);
+    free(F.tpivot);
+}
@@ -0,0 +1,209 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#include "scc_pearce.h"
+#include "graph.h"
+
+/*
+ * Variante de Tarjan due à Pearce ("A space-efficient algorithm for finding
+ * strongly connected components", 2016).
+ *
+ * rindex[v] remplace index, lowlink et on_stack :
+ *   - 0              : sommet non visité ;
+ *   - 1..index-1     : sommet en cours (index de découverte, puis plus petit
+ *                      index accessible) ;
+ *   - c              : sommet rangé dans la classe numéro c, c décroissant à
+ *                      partir de N ; toujours > aux valeurs "en cours",
+ *                      donc jamais retenu comme minimum.
+ * Le booléen "racine" de chaque cadre est un bit par sommet. La pile de
+ * composante ne reçoit que les sommets terminés non racines, et la pile
+ * d'appels ne grandit qu'avec la profondeur du parcours.
+ */
+
+// Contexte de la variante de Pearce
+typedef struct {
+    const AdjList *g;
+    Partition *out;
+    int *rindex;        // [1..N]
+    uint64_t *root;     // bit v : v est encore racine potentielle
+    int *stack;         // pile de composante
+    int sp;
+    int cap;
+    int *call;          // pile d'appels explicite : sommets en cours d'exploration
+    int64_t *call_edge; // arête à (re)prendre pour chaque cadre de 'call'
+    int depth;
+    int call_cap;
+    int index;          // prochain index de découverte
+    int c;              // prochain numéro de classe (décroissant)
+} t_pearce_ctx;
+
+/**
+ * @brief  Alloue un tableau initialisé à zéro avec vérification stricte
+ *
+ * @param[in]  count  Nombre d'éléments
+ * @param[in]  sz     Taille d'un élément en octets
+ *
+ * @return  Pointeur alloué (non NULL si `sz > 0`)
+ *
+ * @warning Termine le programme via `exit(EXIT_FAILURE)` en cas d'échec.
+ */
+static void *xcalloc(size_t count, size_t sz) {
+    void *p = calloc(count, sz);
+    if (!p && count != 0 && sz != 0) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+// Empile v sur la pile de composante (capacité doublée si besoin)
+static void push(t_pearce_ctx *C, int v) {
+    if (C->sp >= C->cap) {
+        int newcap = C->cap > 0 ? C->cap * 2 : 16;
+        int *ns = (int*)realloc(C->stack, (size_t)newcap * sizeof(int));
+        if (!ns) { perror("realloc(stack)"); exit(EXIT_FAILURE); }
+        C->stack = ns;
+        C->cap = newcap;
+    }
+    C->stack[C->sp++] = v;
+}
+
+/**
+ * @brief  Découvre un sommet et ouvre son cadre sur la pile d'appels
+ *
+ * @param[in,out] C  Contexte (index, bit racine et pile d'appels modifiés)
+ * @param[in]     v  Sommet non visité (1..N)
+ */
+static void begin(t_pearce_ctx *C, int v) {
+    if (C->depth >= C->call_cap) {
+        int newcap = C->call_cap > 0 ? C->call_cap * 2 : 64;
+        int *nc = (int*)realloc(C->call, (size_t)newcap * sizeof(int));
+        if (!nc) { perror("realloc(call)"); exit(EXIT_FAILURE); }
+        C->call = nc;
+        int64_t *ne = (int64_t*)realloc(C->call_edge, (size_t)newcap * sizeof(int64_t));
+        if (!ne) { perror("realloc(call_edge)"); exit(EXIT_FAILURE); }
+        C->call_edge = ne;
+        C->call_cap = newcap;
+    }
+    C->rindex[v] = C->index++;
+    C->root[(unsigned)v >> 6] |= (uint64_t)1 << (v & 63);
+    C->call[C->depth] = v;
+    C->call_edge[C->depth] = C->g->offsets[v - 1];
+    C->depth++;
+}
+
+/**
+ * @brief  Termine un sommet : extrait sa classe s'il est racine, sinon l'empile
+ *
+ * Une racine v reprend les sommets de la pile de composante dont le rindex
+ * est >= rindex[v] : ce sont exactement les sommets de sa classe découverts
+ * après elle. Leurs index sont rendus (index décrémenté) et ils reçoivent
+ * le numéro de classe c.
+ *
+ * @param[in,out] C  Contexte (pile, rindex et partition modifiés)
+ * @param[in]     v  Sommet dont tous les successeurs sont traités (1..N)
+ */
+static void finish(t_pearce_ctx *C, int v) {
+    if (!(C->root[(unsigned)v >> 6] >> (v & 63) & 1u)) {
+        push(C, v);
+        return;
+    }
+
+    C->index--;
+    while (C->sp > 0 && C->rindex[v] <= C->rindex[C->stack[C->sp - 1]]) {
+        int w = C->stack[--C->sp];
+        C->rindex[w] = C->c;
+        C->index--;
+        scc_push_member(C->out, w);
+    }
+    C->rindex[v] = C->c;
+    C->c--;
+    scc_push_member(C->out, v);
+    scc_close_class(C->out);
+}
+
+/**
+ * @brief  Parcours itératif depuis un sommet racine non visité
+ *
+ * Chaque cadre garde l'arête en cours : au retour d'un successeur w, la même
+ * arête est reprise et, w étant visité, sert à mettre à jour rindex[v].
+ *
+ * @param[in,out] C     Contexte de Pearce (modifié)
+ * @param[in]     root  Sommet de départ non visité (1..N)
+ */
+static void visit_from(t_pearce_ctx *C, int root) {
+    const AdjList *g = C->g;
+    int *rindex = C->rindex;
+
+    begin(C, root);
+    while (C->depth > 0) {
+        int v = C->call[C->depth - 1];
+        int64_t k = C->call_edge[C->depth - 1];
+        int64_t end = g->offsets[v];
+
+        int descended = 0;
+        for (; k < end; ++k) {
+            int w = g->dests[k];
+            if (rindex[w] == 0) {
+                C->call_edge[C->depth - 1] = k;
+                begin(C, w);
+                descended = 1;
+                break;
+            }
+            if (rindex[w] < rindex[v]) {
+                rindex[v] = rindex[w];
+                C->root[(unsigned)v >> 6] &= ~((uint64_t)1 << (v & 63));
+            }
+        }
+        if (descended) continue;
+
+        C->depth--;
+        finish(C, v);
+    }
+}
+
+/**
+ * @brief  Calcule les CFC d'un graphe avec un entier et un bit par sommet
+ *
+ * Même partition que tarjan_partition, classes dans le même ordre (seul
+ * l'ordre des sommets à l'intérieur d'une classe peut différer). Mémoire de
+ * travail : 4 octets + 1 bit par sommet, plus les piles (composante et
+ * appels) qui ne dépassent N que sur les parcours très profonds.
+ *
+ * @param[in]  g    Graphe d'entrée (liste d'adjacence)
+ * @param[out] out  Partition résultat, initialisée via `scc_init_partition`
+ *
+ * @note  Complexité en O(N + M), avec N sommets et M arêtes.
+ */
+void scc_partition_pearce(const AdjList *g, Partition *out) {
+    if (!g || g->size <= 0) return;
+
+    t_pearce_ctx C;
+    C.g = g;
+    C.out = out;
+    C.rindex = (int*)xcalloc((size_t)g->size + 1, sizeof(int));
+    C.root = (uint64_t*)xcalloc(((size_t)g->size >> 6) + 1, sizeof(uint64_t));
+    C.stack = NULL;
+    C.sp = 0;
+    C.cap = 0;
+    C.call = NULL;
+    C.call_edge = NULL;
+    C.depth = 0;
+    C.call_cap = 0;
+    C.index = 1;
+    C.c = g->size;
+    scc_reserve_partition(out, g->size);
+
+    for (int i = 1; i <= g->size; ++i) {
+        if (C.rindex[i] == 0) {
+            visit_from(&C, i);
+        }
+    }
+
+    free(C.rindex);
+    free(C.root);
+    free(C.stack);
+    free(C.call);
+    free(C.call_edge);
+}
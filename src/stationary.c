@@ -0,0 +1,408 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "stationary.h"
+
+/*
+ * Distribution stationnaire d'une classe irréductible de matrice P (n×n).
+ *
+ * - power : itération pi <- pi P (matrix.c). Lente sur les classes presque
+ *   décomposables, ne converge jamais sur une classe périodique.
+ * - gth : élimination de Grassmann-Taksar-Heyman, factorisation LU de I - P
+ *   où chaque pivot est recalculé comme somme de termes positifs : aucune
+ *   soustraction, précision relative conservée. Dense, O(n³).
+ * - gs / sor : balayages de Gauss-Seidel sur pi (I - P) = 0 lu par
+ *   colonnes (P^T en CSR), pi renormalisé après chaque balayage ; arrêt sur
+ *   le résidu ||pi P - pi||_1.
+ * - bicgstab : le système singulier est rendu régulier en fixant
+ *   x[n-1] = 1. Les n-1 autres inconnues vérifient (I - A) x = b avec
+ *   A = (P privée de sa dernière ligne et colonne)^T et b[j] = P[n-1][j] ;
+ *   I - A est une M-matrice régulière car la classe est irréductible.
+ *   pi = x / somme(x). (Gauss-Seidel sur ce système réduit converge mal :
+ *   la seule fuite passe par l'état fixé.)
+ */
+
+static const struct {
+    const char   *name;
+    t_stat_solver solver;
+} SOLVER_NAMES[] = {
+    {"power", STAT_POWER},
+    {"gth", STAT_GTH},
+    {"gs", STAT_GS},
+    {"sor", STAT_SOR},
+    {"bicgstab", STAT_BICGSTAB},
+    {"auto", STAT_AUTO},
+};
+
+#define SOLVER_COUNT ((int)(sizeof(SOLVER_NAMES) / sizeof(SOLVER_NAMES[0])))
+
+/**
+ * @brief  Convertit un nom de solveur (option --stationary-solver)
+ *
+ * @param[in]  name  power, gth, gs, sor, bicgstab ou auto
+ * @param[out] out   Solveur correspondant
+ *
+ * @return  0 si le nom est reconnu, -1 sinon
+ */
+int stationary_solver_parse(const char *name, t_stat_solver *out) {
+    if (!name || !out) return -1;
+    for (int i = 0; i < SOLVER_COUNT; ++i) {
+        if (strcmp(name, SOLVER_NAMES[i].name) == 0) {
+            *out = SOLVER_NAMES[i].solver;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// Nom d'un solveur (pour l'affichage)
+const char *stationary_solver_name(t_stat_solver s) {
+    for (int i = 0; i < SOLVER_COUNT; ++i) {
+        if (SOLVER_NAMES[i].solver == s) return SOLVER_NAMES[i].name;
+    }
+    return "?";
+}
+
+/**
+ * @brief  Résidu stationnaire ||pi S - pi||_1
+ *
+ * @param[in] SC  Matrice de transition creuse n×n
+ * @param[in] pi  Distribution (taille n)
+ *
+ * @return  Norme L1 du résidu (calcul en double)
+ */
+double stationary_residual(const t_spmatrix *SC, const float *pi) {
+    if (!SC || SC->n <= 0 || !pi) return 0.0;
+
+    int n = SC->n;
+    double *y = (double *)calloc((size_t)n, sizeof(double));
+    if (!y) {
+        perror("calloc(residual)");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; ++i) {
+        double p = (double)pi[i];
+        if (p == 0.0) continue;
+        for (int64_t k = SC->row_ptr[i]; k < SC->row_ptr[i + 1]; ++k) {
+            y[SC->col[k]] += p * (double)SC->val[k];
+        }
+    }
+    double r = 0.0;
+    for (int j = 0; j < n; ++j) {
+        double d = y[j] - (double)pi[j];
+        r += d < 0.0 ? -d : d;
+    }
+    free(y);
+    return r;
+}
+
+/**
+ * @brief  Distribution stationnaire par élimination GTH
+ *
+ * Pour k = n-1 .. 1 : s = somme des P[k][j], j < k ; la colonne k est
+ * divisée par s puis l'état k est éliminé (P[i][j] += P[i][k] P[k][j]).
+ * Remontée : x[0] = 1, x[k] = somme des x[i] P[i][k], i < k, puis
+ * normalisation. Seuls des produits et des sommes de termes positifs.
+ *
+ * @param[in]  SC      Matrice de transition creuse de la classe (irréductible)
+ * @param[out] pi_out  Distribution stationnaire (taille SC->n)
+ * @param[out] info    Bilan (itérations = 0, méthode directe ; peut être NULL)
+ *
+ * @return  1 si la factorisation a abouti, 0 si un pivot est nul (classe non irréductible)
+ */
+int stationary_gth(const t_spmatrix *SC, float *pi_out, t_solve_info *info) {
+    if (info) { info->iters = 0; info->residual = 0.0; info->converged = 0; }
+    if (!SC || SC->n <= 0 || !pi_out) return 0;
+
+    int n = SC->n;
+    double *a = (double *)calloc((size_t)n * (size_t)n, sizeof(double));
+    double *x = (double *)malloc((size_t)n * sizeof(double));
+    if (!a || !x) {
+        perror("calloc(gth)");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; ++i) {
+        for (int64_t k = SC->row_ptr[i]; k < SC->row_ptr[i + 1]; ++k) {
+            a[(size_t)i * n + SC->col[k]] = (double)SC->val[k];
+        }
+    }
+
+    int ok = 1;
+    for (int k = n - 1; k > 0 && ok; --k) {
+        double *rk = a + (size_t)k * n;
+        double s = 0.0;
+        for (int j = 0; j < k; ++j) s += rk[j];
+        if (s <= 0.0) { ok = 0; break; }
+        for (int i = 0; i < k; ++i) {
+            double *ri = a + (size_t)i * n;
+            double f = ri[k] / s;
+            ri[k] = f;
+            if (f == 0.0) continue;
+            for (int j = 0; j < k; ++j) ri[j] += f * rk[j];
+        }
+    }
+
+    if (ok) {
+        double total = 1.0;
+        x[0] = 1.0;
+        for (int k = 1; k < n; ++k) {
+            double s = 0.0;
+            for (int i = 0; i < k; ++i) s += x[i] * a[(size_t)i * n + k];
+            x[k] = s;
+            total += s;
+        }
+        for (int i = 0; i < n; ++i) pi_out[i] = (float)(x[i] / total);
+    } else {
+        for (int i = 0; i < n; ++i) pi_out[i] = 0.0f;
+    }
+
+    free(a);
+    free(x);
+    if (info) {
+        info->residual = ok ? stationary_residual(SC, pi_out) : 0.0;
+        info->converged = ok;
+    }
+    return ok;
+}
+
+/**
+ * @brief  Transposée du bloc m×m de tête de SC
+ *
+ * A[j][i] = P[i][j] pour i, j < m (transposition par dénombrement des
+ * colonnes, lignes de A triées par i croissant).
+ *
+ * @param[in]  SC  Matrice de transition creuse n×n
+ * @param[in]  m   Taille du bloc (m <= n)
+ * @param[out] A   Matrice m×m, à libérer via spmx_free
+ */
+static void transpose_block(const t_spmatrix *SC, int m, t_spmatrix *A) {
+    A->n = m;
+    A->row_ptr = (int64_t *)calloc((size_t)m + 1, sizeof(int64_t));
+    if (!A->row_ptr) {
+        perror("calloc(transpose)");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < m; ++i) {
+        for (int64_t k = SC->row_ptr[i]; k < SC->row_ptr[i + 1]; ++k) {
+            if (SC->col[k] < m) A->row_ptr[SC->col[k] + 1]++;
+        }
+    }
+    for (int j = 0; j < m; ++j) A->row_ptr[j + 1] += A->row_ptr[j];
+    A->nnz = A->row_ptr[m];
+    A->col = (int *)malloc((size_t)(A->nnz > 0 ? A->nnz : 1) * sizeof(int));
+    A->val = (float *)malloc((size_t)(A->nnz > 0 ? A->nnz : 1) * sizeof(float));
+    int64_t *fill = (int64_t *)malloc((size_t)m * sizeof(int64_t));
+    if (!A->col || !A->val || !fill) {
+        perror("malloc(transpose)");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(fill, A->row_ptr, (size_t)m * sizeof(int64_t));
+    for (int i = 0; i < m; ++i) {
+        for (int64_t k = SC->row_ptr[i]; k < SC->row_ptr[i + 1]; ++k) {
+            int j = SC->col[k];
+            if (j >= m) continue;
+            int64_t pos = fill[j]++;
+            A->col[pos] = i;
+            A->val[pos] = SC->val[k];
+        }
+    }
+    free(fill);
+}
+
+/**
+ * @brief  Système réduit (I - A) x = b de la stationnaire, x[n-1] = 1 fixé
+ *
+ * @param[in]  SC  Matrice de transition creuse n×n (n >= 2)
+ * @param[out] A   Transposée du bloc (n-1)×(n-1), à libérer via spmx_free
+ * @param[out] b   Second membre b[j] = P[n-1][j] (taille n-1)
+ */
+static void reduced_system(const t_spmatrix *SC, t_spmatrix *A, double *b) {
+    int m = SC->n - 1;
+    transpose_block(SC, m, A);
+    for (int j = 0; j < m; ++j) b[j] = 0.0;
+    for (int64_t k = SC->row_ptr[m]; k < SC->row_ptr[m + 1]; ++k) {
+        if (SC->col[k] < m) b[SC->col[k]] += (double)SC->val[k];
+    }
+}
+
+/**
+ * @brief  Stationnaire par Gauss-Seidel / SOR sur le système complet
+ *
+ * Balayage : pi[j] <- (1 - omega) pi[j] + omega (somme_{i != j} pi[i] P[i][j]) / (1 - P[j][j]),
+ * les pi[i] déjà mis à jour étant utilisés aussitôt, puis normalisation.
+ * Les colonnes de P sont lues par la transposée (construite une fois).
+ *
+ * @param[in]  SC        Matrice de transition creuse n×n (n >= 2)
+ * @param[in]  omega     Relaxation (1 = Gauss-Seidel)
+ * @param[in]  tol       Tolérance sur ||pi P - pi||_1
+ * @param[in]  max_iter  Nombre maximal de balayages
+ * @param[out] pi_out    Distribution (taille n)
+ * @param[out] info      Nombre de balayages
+ *
+ * @return  1 si convergé, 0 sinon
+ */
+static int stationary_sor_full(const t_spmatrix *SC, double omega, double tol,
+                               int max_iter, float *pi_out, t_solve_info *info) {
+    int n = SC->n;
+    t_spmatrix T = {0, 0, NULL, NULL, NULL};
+    transpose_block(SC, n, &T);
+    double *x = (double *)malloc((size_t)n * sizeof(double));
+    double *diag = (double *)malloc((size_t)n * sizeof(double));
+    if (!x || !diag) {
+        perror("malloc(stationary)");
+        exit(EXIT_FAILURE);
+    }
+    for (int j = 0; j < n; ++j) {
+        x[j] = 1.0 / (double)n;
+        diag[j] = 1.0;
+        for (int64_t k = T.row_ptr[j]; k < T.row_ptr[j + 1]; ++k) {
+            if (T.col[k] == j) diag[j] -= (double)T.val[k];
+        }
+    }
+
+    int it = 0;
+    int conv = 0;
+    while (it < max_iter && !conv) {
+        double total = 0.0;
+        for (int j = 0; j < n; ++j) {
+            double s = 0.0;
+            for (int64_t k = T.row_ptr[j]; k < T.row_ptr[j + 1]; ++k) {
+                if (T.col[k] != j) s += (double)T.val[k] * x[T.col[k]];
+            }
+            // diag[j] > 0 dans une classe irréductible de taille >= 2
+            x[j] = (1.0 - omega) * x[j] + omega * s / diag[j];
+            if (x[j] < 0.0) x[j] = 0.0;
+            total += x[j];
+        }
+        it++;
+        if (!(total > 0.0)) {
+            // divergence (omega trop grand) : masse nulle ou NaN, on repart de l'uniforme
+            for (int j = 0; j < n; ++j) x[j] = 1.0 / (double)n;
+            break;
+        }
+        for (int j = 0; j < n; ++j) x[j] /= total;
+
+        double res = 0.0;
+        for (int j = 0; j < n; ++j) {
+            double y = 0.0;
+            for (int64_t k = T.row_ptr[j]; k < T.row_ptr[j + 1]; ++k) {
+                y += (double)T.val[k] * x[T.col[k]];
+            }
+            res += (y > x[j]) ? y - x[j] : x[j] - y;
+        }
+        conv = (res <= tol);
+    }
+
+    for (int j = 0; j < n; ++j) pi_out[j] = (float)x[j];
+    info->iters = it;
+    spmx_free(&T);
+    free(x);
+    free(diag);
+    return conv;
+}
+
+/**
+ * @brief  Stationnaire par BiCGSTAB sur le système réduit
+ *
+ * @param[in]  SC        Matrice de transition creuse n×n (n >= 2)
+ * @param[in]  tol       Tolérance relative du solveur linéaire
+ * @param[in]  max_iter  Nombre maximal d'itérations
+ * @param[out] pi_out    Distribution (taille n)
+ * @param[out] info      Bilan du solveur (itérations, convergence)
+ *
+ * @return  1 si convergé, 0 sinon
+ */
+static int stationary_bicgstab(const t_spmatrix *SC, double tol, int max_iter,
+                               float *pi_out, t_solve_info *info) {
+    int n = SC->n;
+    t_spmatrix A = {0, 0, NULL, NULL, NULL};
+    double *x = (double *)malloc((size_t)n * sizeof(double));
+    double *b = (double *)malloc((size_t)n * sizeof(double));
+    if (!x || !b) {
+        perror("malloc(stationary)");
+        exit(EXIT_FAILURE);
+    }
+    reduced_system(SC, &A, b);
+    for (int i = 0; i < n; ++i) x[i] = 1.0;
+
+    int rc = sp_solve_bicgstab(&A, b, x, tol, max_iter, info);
+
+    // x[n-1] = 1 ; les petites valeurs négatives (arrondis) sont ramenées à 0
+    double total = 0.0;
+    for (int i = 0; i < n; ++i) {
+        if (x[i] < 0.0) x[i] = 0.0;
+        total += x[i];
+    }
+    for (int i = 0; i < n; ++i) pi_out[i] = (float)(x[i] / total);
+
+    spmx_free(&A);
+    free(x);
+    free(b);
+    return rc == 1;
+}
+
+/**
+ * @brief  Distribution stationnaire d'une classe avec le solveur choisi
+ *
+ * @param[in]  SC        Matrice de transition creuse de la classe persistante
+ * @param[in]  solver    Solveur (STAT_AUTO : GTH si n <= STAT_GTH_MAX_N, sinon BiCGSTAB
+ *                       puis Gauss-Seidel s'il n'a pas convergé)
+ * @param[in]  eps       Tolérance : écart L1 entre itérés (power), résidu
+ *                       ||pi P - pi||_1 (gs, sor), résidu relatif du système réduit (bicgstab)
+ * @param[in]  max_iter  Nombre maximal d'itérations (ignoré par GTH)
+ * @param[in]  omega     Relaxation pour STAT_SOR (0 < omega < 2)
+ * @param[out] pi_out    Distribution stationnaire (taille SC->n)
+ * @param[out] info      Itérations, résidu ||pi SC - pi||_1 et convergence (peut être NULL)
+ *
+ * @return  1 si convergé, 0 sinon
+ */
+int stationary_solve(const t_spmatrix *SC, t_stat_solver solver, float eps, int max_iter,
+                     double omega, float *pi_out, t_solve_info *info) {
+    t_solve_info local = {0, 0.0, 0};
+    if (!info) info = &local;
+    info->iters = 0;
+    info->residual = 0.0;
+    info->converged = 0;
+    if (!SC || !SC->row_ptr || SC->n <= 0 || !pi_out) return 0;
+    if (eps < 0.0f) eps = -eps;
+
+    int fallback = 0;
+    if (solver == STAT_AUTO) {
+        solver = (SC->n <= STAT_GTH_MAX_N) ? STAT_GTH : STAT_BICGSTAB;
+        fallback = (solver == STAT_BICGSTAB);
+    }
+
+    int conv;
+    if (SC->n == 1 && solver != STAT_POWER) {
+        pi_out[0] = 1.0f;
+        conv = 1;
+    } else if (solver == STAT_POWER) {
+        conv = stationary_power_sp(SC, eps, max_iter, pi_out, &info->iters);
+    } else if (solver == STAT_GTH) {
+        conv = stationary_gth(SC, pi_out, info);
+    } else if (solver == STAT_BICGSTAB) {
+        conv = stationary_bicgstab(SC, (double)eps, max_iter, pi_out, info);
+        if (!conv && fallback) {
+            // interruption de BiCGSTAB : Gauss-Seidel, plus lent mais sans interruption
+            int used = info->iters;
+            conv = stationary_sor_full(SC, 1.0, (double)eps, max_iter, pi_out, info);
+            info->iters += used;
+        }
+    } else {
+        conv = stationary_sor_full(SC, solver == STAT_SOR ? omega : 1.0, (double)eps,
+                                   max_iter, pi_out, info);
+    }
+
+    info->residual = stationary_residual(SC, pi_out);
+    if (!isfinite(info->residual)) {
+        // Classe hors Markov (somme sortante > 1) : pas de vecteur NaN/inf
+        for (int i = 0; i < SC->n; ++i) pi_out[i] = 0.0f;
+        info->residual = 0.0;
+        conv = 0;
+    }
+    info->converged = conv;
+    return conv;
+}
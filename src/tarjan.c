@@ -4,7 +4,6 @@
 
 #include "tarjan.h"
 #include "graph.h"
-#include "list.h"
 
 /**
  * @brief  Alloue un bloc mémoire avec vérification stricte
@@ -68,11 +67,53 @@ static int pop(t_ctx *C) {
 }
 
 /**
- * @brief  Étape récursive principale de l'algorithme de Tarjan
+ * @brief  Découvre un sommet : index/lowlink et empilement
+ *
+ * @param[in,out] C     Contexte de Tarjan (compteur d'index et pile modifiés)
+ * @param[in]     v_id  Identifiant du sommet découvert (1..N)
+ */
+static void visit(t_ctx *C, int v_id) {
+    t_tarjan_vertex *v = &C->V[v_id];
+    v->index = C->next_index;
+    v->lowlink = C->next_index;
+    C->next_index++;
+    push(C, v_id);
+    v->on_stack = 1;
+}
+
+/**
+ * @brief  Termine un sommet : si c'est une racine, extrait sa composante
+ *
+ * Si `lowlink == index`, dépile tous les sommets jusqu'à `v_id` et les ajoute
+ * comme nouvelle classe de la partition de sortie.
+ *
+ * @param[in,out] C     Contexte de Tarjan (pile et partition modifiées)
+ * @param[in]     v_id  Identifiant du sommet terminé (1..N)
+ */
+static void finish(t_ctx *C, int v_id) {
+    t_tarjan_vertex *v = &C->V[v_id];
+    if (v->lowlink != v->index) return;
+
+    // Dépile tous les sommets de la composante (jusqu'à v), écrits
+    // directement à la suite des membres de la partition
+    while (1) {
+        int w = pop(C);
+        if (w < 0) break; // sécurité
+        C->V[w].on_stack = 0;
+        scc_push_member(C->out, w); // Ajoute w à la classe courante
+        if (w == v_id) break;
+    }
+    // Ferme la classe dans la partition de sortie
+    scc_close_class(C->out);
+}
+
+/**
+ * @brief  Étape récursive de l'algorithme de Tarjan (version de référence)
  *
  * Marque le sommet `v_id`, explore ses successeurs et met à jour les
  * valeurs `index`/`lowlink`. Si `v_id` est racine d'une composante fortement
  * connexe, dépile la composante et l'ajoute à la partition de sortie.
+ * Profondeur de récursion = profondeur du parcours (jusqu'à N).
  *
  * @param[in,out] C     Contexte global de Tarjan (modifié)
  * @param[in]     v_id  Identifiant du sommet courant (1..N)
@@ -80,24 +121,15 @@ static int pop(t_ctx *C) {
  * @pre  `C` initialisé, `C->V[v_id].index == -1` au premier appel
  */
 static void strongconnect(t_ctx *C, int v_id) {
-    // Récupère le sommet courant
     t_tarjan_vertex *V = C->V;
     t_tarjan_vertex *v = &V[v_id];
-
-    // Initialise index et lowlink de v
-    v->index = C->next_index;
-    v->lowlink = C->next_index;
-    // Incrémente l'index global pour le prochain sommet
-    C->next_index++;
-
-    // Empile v sur la pile C
-    push(C, v_id);
-    v->on_stack = 1;
+    visit(C, v_id);
 
     // Pour chaque successeur w de v
-    for (Cell *c = C->g->array[v_id - 1].head; c; c = c->next) {
+    const AdjList *g = C->g;
+    for (int64_t k = g->offsets[v_id - 1]; k < g->offsets[v_id]; ++k) {
         // Récupère l'identifiant du successeur
-        int w_id = c->dest;
+        int w_id = g->dests[k];
         // Vérif si w n'a pas encore été visité
         if (V[w_id].index == -1) {
             // Appel récursif sur w
@@ -110,28 +142,111 @@ static void strongconnect(t_ctx *C, int v_id) {
         }
     }
 
-    // Si v est racine d'une composante fortement connexe
-    if (v->lowlink == v->index) {
-        // Crée une nouvelle classe SCC
-        SccClass cls = scc_make_empty_class();
-        // Dépile tous les sommets de la composante (jusqu'à v)
-        while (1) {
-            int w = pop(C);
-            if (w < 0) break; // sécurité
-            C->V[w].on_stack = 0;
-            scc_add_vertex(&cls, w); // Ajoute w à la classe courante
-            if (w == v_id) break;
+    finish(C, v_id);
+}
+
+/**
+ * @brief  Tarjan sans récursion à partir d'un sommet racine
+ *
+ * Même parcours que `strongconnect`, la pile d'appels étant remplacée par
+ * une pile explicite (C->call) : chaque cadre garde le sommet et la
+ * prochaine arête à explorer, reprise au retour du successeur. Les classes
+ * sont produites dans le même ordre que la version récursive, sans limite
+ * de profondeur liée à la pile système.
+ *
+ * @param[in,out] C     Contexte global de Tarjan (modifié)
+ * @param[in]     root  Sommet de départ non visité (1..N)
+ */
+static void strongconnect_iter(t_ctx *C, int root) {
+    t_tarjan_vertex *V = C->V;
+    const AdjList *g = C->g;
+
+    int depth = 0;
+    visit(C, root);
+    C->call[depth] = root;
+    C->call_edge[depth] = g->offsets[root - 1];
+    depth++;
+
+    while (depth > 0) {
+        int v_id = C->call[depth - 1];
+        t_tarjan_vertex *v = &V[v_id];
+        int64_t k = C->call_edge[depth - 1];
+        int64_t end = g->offsets[v_id];
+
+        // Reprend l'exploration des successeurs de v là où elle s'était arrêtée
+        int descended = 0;
+        for (; k < end; ++k) {
+            int w_id = g->dests[k];
+            if (V[w_id].index == -1) {
+                // "Appel" sur w : v reprendra à l'arête suivante
+                C->call_edge[depth - 1] = k + 1;
+                visit(C, w_id);
+                C->call[depth] = w_id;
+                C->call_edge[depth] = g->offsets[w_id - 1];
+                depth++;
+                descended = 1;
+                break;
+            } else if (V[w_id].on_stack) {
+                if (V[w_id].index < v->lowlink) v->lowlink = V[w_id].index;
+            }
         }
-        // Ajoute la classe complète à la partition de sortie
-        scc_add_class(C->out, cls);
+        if (descended) continue;
+
+        // Tous les successeurs de v sont traités : "retour" vers l'appelant
+        finish(C, v_id);
+        depth--;
+        if (depth > 0) {
+            t_tarjan_vertex *parent = &V[C->call[depth - 1]];
+            if (v->lowlink < parent->lowlink) parent->lowlink = v->lowlink;
+        }
+    }
+}
+
+/**
+ * @brief  Initialise le contexte de Tarjan (sommets non visités, pile vide)
+ *
+ * @param[out] C    Contexte à initialiser (à libérer via ctx_free)
+ * @param[in]  g    Graphe d'entrée
+ * @param[in]  out  Partition de sortie
+ */
+static void ctx_init(t_ctx *C, const AdjList *g, Partition *out) {
+    C->g = g;
+    C->out = out;
+    C->N = g->size;
+    C->V = (t_tarjan_vertex*)xmalloc((size_t)(C->N + 1) * sizeof(t_tarjan_vertex));
+    C->stack = NULL;
+    C->sp = 0;
+    C->cap = 0;
+    C->next_index = 0;
+    C->call = NULL;
+    C->call_edge = NULL;
+    // Les N sommets seront rangés : partition remplie sans réallocation
+    scc_reserve_partition(out, C->N);
+
+    // Init le tableau de sommet dans le contexte 'C' avec les valeurs de 'g'
+    for (int i = 1; i <= C->N; ++i) {
+        C->V[i].id = i;
+        C->V[i].index = -1;    // non défini
+        C->V[i].lowlink = -1;
+        C->V[i].on_stack = 0;
     }
 }
 
+// Libère les tableaux du contexte de Tarjan
+static void ctx_free(t_ctx *C) {
+    free(C->V);
+    free(C->stack);
+    free(C->call);
+    free(C->call_edge);
+}
+
 /**
  * @brief  Calcule les CFC d'un graphe par l'algorithme de Tarjan
  *
  * Parcourt tous les sommets du graphe et applique Tarjan pour produire
- * une partition en composantes fortement connexes.
+ * une partition en composantes fortement connexes. Le parcours est itératif
+ * (pile explicite) : pas de débordement de pile sur les graphes profonds
+ * (chaînes de plusieurs millions d'états).
  *
  * @param[in]  g    Graphe d'entrée (liste d'adjacence), `g->size >= 1`
  * @param[out] out  Partition résultat, initialisée via `scc_init_partition`
@@ -142,26 +257,38 @@ static void strongconnect(t_ctx *C, int v_id) {
 void tarjan_partition(const AdjList *g, Partition *out) {
     if (!g || g->size <= 0) return;
 
-    // Init du contexte de l'algorithme
     t_ctx C;
-    C.g = g;
-    C.out = out;
-    C.N = g->size;
-    C.V = (t_tarjan_vertex*)xmalloc((size_t)(C.N + 1) * sizeof(t_tarjan_vertex));
-    C.stack = NULL;
-    C.sp = 0;
-    C.cap = 0;
-    C.next_index = 0;
+    ctx_init(&C, g, out);
+    // Pile d'appels explicite : profondeur au plus N
+    C.call = (int*)xmalloc((size_t)C.N * sizeof(int));
+    C.call_edge = (int64_t*)xmalloc((size_t)C.N * sizeof(int64_t));
 
-    // Init le tableau de sommet dans le contexte 'C' avec les valeurs de 'g'
+    // Parcourt tous les sommets de 'g' (stockés dans le tab 'C.V[]')
     for (int i = 1; i <= C.N; ++i) {
-        C.V[i].id = i;
-        C.V[i].index = -1;    // non défini
-        C.V[i].lowlink = -1;
-        C.V[i].on_stack = 0;
+        if (C.V[i].index == -1) {
+            strongconnect_iter(&C, i);
+        }
     }
 
-    // Parcourt tous les sommets de 'g' (stockés dans le tab 'C.V[]')
+    ctx_free(&C);
+}
+
+/**
+ * @brief  Variante récursive de tarjan_partition (référence, benchmarks)
+ *
+ * Même partition, classes dans le même ordre. La récursion descend d'un
+ * niveau par sommet du parcours : déborde la pile système sur les chaînes
+ * longues.
+ *
+ * @param[in]  g    Graphe d'entrée (liste d'adjacence)
+ * @param[out] out  Partition résultat, initialisée via `scc_init_partition`
+ */
+void tarjan_partition_recursive(const AdjList *g, Partition *out) {
+    if (!g || g->size <= 0) return;
+
+    t_ctx C;
+    ctx_init(&C, g, out);
+
     for (int i = 1; i <= C.N; ++i) {
         if (C.V[i].index == -1) {
             // Appel recurcif de la fonction
@@ -169,6 +296,5 @@ void tarjan_partition(const AdjList *g, Partition *out) {
         }
     }
 
-    free(C.V);
-    free(C.stack);
+    ctx_free(&C);
 }
@@ -6,6 +6,9 @@
 #include <sys/types.h>
 #include <libgen.h>
 #include <math.h>
+#ifndef _WIN32
+  #include <sys/resource.h>
+#endif
 
 #include "utils.h"
 
@@ -152,3 +155,26 @@ int ensure_dir(const char *path) {
     free(copy);
     return 0;
 }
+
+/**
+ * @brief  Pic de mémoire résidente (RSS) du processus depuis son lancement
+ *
+ * Lu via `getrusage` (`ru_maxrss`, en Ko sous Linux, en octets sous macOS).
+ * Le pic ne redescend jamais : pour mesurer une étape, comparer la valeur
+ * avant et après elle.
+ *
+ * @return  Pic RSS en Ko, ou -1 si la mesure n'est pas disponible
+ */
+long peak_rss_kb(void) {
+#ifdef _WIN32
+    return -1;
+#else
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) != 0) return -1;
+  #ifdef __APPLE__
+    return (long)(ru.ru_maxrss / 1024);
+  #else
+    return (long)ru.ru_maxrss;
+  #endif
+#endif
+}
@@ -15,7 +15,7 @@ static int in_range(float x, float a, float b) {
  * @return int  1 si le graphe est valide, sinon 0
  */
 int verify_markov(const AdjList *g, float eps) {
-    if (!g || g->size <= 0 || !g->array) {
+    if (!g || g->size <= 0 || !g->offsets) {
         fprintf(stderr, "[Markov][ERR] Graphe invalide (structure non initialisée).\n");
         return 0;
     }
@@ -26,26 +26,26 @@ int verify_markov(const AdjList *g, float eps) {
     for (int i = 1; i <= g->size; ++i) {
         // Initialisation de la somme des probabilités sortantes
         float sum = 0.0f;
-        // Récupération de la liste des sorties du sommet i
-        List *lst = &g->array[i - 1];
 
-        // Itération sur chaque cellule de la liste
-        for (Cell *c = lst->head; c; c = c->next) {
+        // Itération sur chaque arête sortante du sommet i
+        for (int64_t k = g->offsets[i - 1]; k < g->offsets[i]; ++k) {
+            float proba = g->probas[k];
+            int dest = g->dests[k];
             // Vérification de la probabilité (comprise entre 0 et 1)
-            if (c->proba < 0.0f || c->proba > 1.0f) {
+            if (proba < 0.0f || proba > 1.0f) {
                 fprintf(stderr, "[Markov][ERR] Sommet %d: probabilité invalide %.6f vers %d\n",
-                        i, c->proba, c->dest);
+                        i, proba, dest);
                 ok = 0;
             }
             // Vérification de la destination (doit être un sommet valide)
-            if (c->dest < 1 || c->dest > g->size) {
+            if (dest < 1 || dest > g->size) {
                 fprintf(stderr, "[Markov][ERR] Sommet %d: destination hors bornes %d (1..%d)\n",
-                        i, c->dest, g->size);
+                        i, dest, g->size);
                 ok = 0;
             }
 
             // Incrémente la somme des probabilités
-            sum += c->proba;
+            sum += proba;
         }
 
         // Vérification que la somme des probabilités sortantes = 1 (+- eps)
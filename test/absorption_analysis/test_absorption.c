@@ -0,0 +1,383 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph.h"
+#include "scc.h"
+#include "tarjan.h"
+#include "hasse.h"
+#include "markov_props.h"
+#include "absorption.h"
+
+static const double EPS = 1e-6;
+
+static double dabs(double v)
+{
+    return v < 0.0 ? -v : v;
+}
+
+static void check_int_equal(const char *label, int got, int expected, int *failures)
+{
+    if (got == expected) {
+        printf("  [OK]   %s (attendu=%d, obtenu=%d)\n", label, expected, got);
+    } else {
+        printf("  [FAIL] %s (attendu=%d, obtenu=%d)\n", label, expected, got);
+        (*failures)++;
+    }
+}
+
+static void check_double_close(const char *label, double got, double expected, double tol, int *failures)
+{
+    if (dabs(got - expected) <= tol) {
+        printf("  [OK]   %s (attendu=%.6f, obtenu=%.6f)\n", label, expected, got);
+    } else {
+        printf("  [FAIL] %s (attendu=%.6f, obtenu=%.6f)\n", label, expected, got);
+        (*failures)++;
+    }
+}
+
+/**
+ * @brief  Partition de Tarjan et types de classes (markov_class_types)
+ *
+ * @return  Tableau is_persistent de taille P->count (à libérer)
+ */
+static int *classify(const AdjList *g, Partition *P)
+{
+    scc_init_partition(P);
+    tarjan_partition(g, P);
+    HasseLinkArray L;
+    hasse_init_links(&L);
+    build_class_links(g, P, &L);
+    int *is_transient = malloc((size_t)P->count * sizeof(int));
+    int *is_persistent = malloc((size_t)P->count * sizeof(int));
+    markov_class_types(&L, P->count, is_transient, is_persistent);
+    free(is_transient);
+    hasse_free_links(&L);
+    return is_persistent;
+}
+
+// Probabilité rangée dans la ligne i pour la cible t (0 si absente)
+static double row_prob(const t_absorption *a, int i, int t)
+{
+    for (int64_t e = a->row_ptr[i]; e < a->row_ptr[i + 1]; ++e) {
+        if (a->tgt[e] == t) return a->prob[e];
+    }
+    return 0.0;
+}
+
+/**
+ * @brief  Référence dense : élimination de Gauss sur (I - Q) [B | t] = [R | 1]
+ *
+ * Construit Q et R sur les lignes de a->row_of, puis compare chaque
+ * probabilité et chaque temps moyen au résultat creux.
+ *
+ * @return  Plus grand écart absolu observé
+ */
+static double max_error_vs_dense(const AdjList *g, const Partition *P, const t_absorption *a)
+{
+    int n = a->n_states, nt = a->n_targets, w = n + nt + 1;
+    double *M = calloc((size_t)n * w, sizeof(double));
+    int *target_of = malloc((size_t)P->count * sizeof(int));
+    for (int k = 0; k < P->count; ++k) target_of[k] = -1;
+    for (int t = 0; t < nt; ++t) target_of[a->target_class[t]] = t;
+
+    for (int v = 1; v <= g->size; ++v) {
+        int i = a->row_of[v];
+        if (i < 0) continue;
+        double *row = M + (size_t)i * w;
+        row[i] += 1.0;
+        row[n + nt] = 1.0;
+        for (int64_t e = g->offsets[v - 1]; e < g->offsets[v]; ++e) {
+            int d = g->dests[e];
+            if (a->row_of[d] >= 0) {
+                row[a->row_of[d]] -= g->probas[e];
+            } else {
+                row[n + target_of[P->class_of[d]]] += g->probas[e];
+            }
+        }
+    }
+
+    for (int c = 0; c < n; ++c) {
+        int piv = c;
+        for (int r = c + 1; r < n; ++r) {
+            if (dabs(M[(size_t)r * w + c]) > dabs(M[(size_t)piv * w + c])) piv = r;
+        }
+        if (piv != c) {
+            for (int j = 0; j < w; ++j) {
+                double tmp = M[(size_t)c * w + j];
+                M[(size_t)c * w + j] = M[(size_t)piv * w + j];
+                M[(size_t)piv * w + j] = tmp;
+            }
+        }
+        for (int r = 0; r < n; ++r) {
+            if (r == c) continue;
+            double f = M[(size_t)r * w + c] / M[(size_t)c * w + c];
+            if (f == 0.0) continue;
+            for (int j = c; j < w; ++j) M[(size_t)r * w + j] -= f * M[(size_t)c * w + j];
+        }
+    }
+
+    double err = 0.0;
+    for (int i = 0; i < n; ++i) {
+        double d = M[(size_t)i * w + i];
+        for (int t = 0; t < nt; ++t) {
+            double e = dabs(M[(size_t)i * w + n + t] / d - row_prob(a, i, t));
+            if (e > err) err = e;
+        }
+        double ref = M[(size_t)i * w + n + nt] / d;
+        double e = dabs(ref - a->steps[i]) / (ref > 1.0 ? ref : 1.0);
+        if (e > err) err = e;
+    }
+    free(target_of);
+    free(M);
+    return err;
+}
+
+// Somme des probabilités d'absorption de chaque état transitoire = 1
+static int rows_sum_to_one(const t_absorption *a)
+{
+    for (int i = 0; i < a->n_states; ++i) {
+        double s = 0.0;
+        for (int64_t e = a->row_ptr[i]; e < a->row_ptr[i + 1]; ++e) s += a->prob[e];
+        if (dabs(s - 1.0) > 1e-6) return 0;
+    }
+    return 1;
+}
+
+static void test_gambler_ruin(int *failures)
+{
+    printf("\n--- TEST 1 : ruine du joueur, 1 et 5 absorbants, p = 1/2 ---\n");
+
+    AdjList g;
+    graph_init(&g, 5);
+    graph_add_edge(&g, 1, 1, 1.0f);
+    for (int v = 2; v <= 4; ++v) {
+        graph_add_edge(&g, v, v - 1, 0.5f);
+        graph_add_edge(&g, v, v + 1, 0.5f);
+    }
+    graph_add_edge(&g, 5, 5, 1.0f);
+
+    Partition P;
+    int *is_persistent = classify(&g, &P);
+    t_absorption a;
+    int rc = absorption_compute(&g, &P, is_persistent, ABSORB_TOL, ABSORB_MAX_ITER, &a);
+
+    check_int_equal("Convergence", rc, 1, failures);
+    check_int_equal("Etats transitoires", a.n_states, 3, failures);
+    check_int_equal("Cibles persistantes", a.n_targets, 2, failures);
+
+    // P(finir en 5 | départ i) = (i-1)/4, temps moyen (i-1)(5-i)
+    int t5 = (a.target_class[0] == P.class_of[5]) ? 0 : 1;
+    for (int v = 2; v <= 4; ++v) {
+        char label[64];
+        int row = a.row_of[v];
+        snprintf(label, sizeof(label), "P(5 | %d)", v);
+        check_double_close(label, absorption_prob(&a, v, t5), (v - 1) / 4.0, EPS, failures);
+        snprintf(label, sizeof(label), "Temps moyen depuis %d", v);
+        check_double_close(label, a.steps[row], (double)((v - 1) * (5 - v)), EPS, failures);
+    }
+    check_int_equal("Etat absorbant sans ligne", a.row_of[1], -1, failures);
+
+    absorption_free(&a);
+    free(is_persistent);
+    scc_free_partition(&P);
+    graph_free(&g);
+}
+
+static void test_chained_transient_classes(int *failures)
+{
+    printf("\n--- TEST 2 : classes transitoires en chaîne {1,2} -> {3,4} -> {5}, {6,7} ---\n");
+
+    AdjList g;
+    graph_init(&g, 7);
+    graph_add_edge(&g, 1, 2, 0.7f);
+    graph_add_edge(&g, 1, 6, 0.3f);
+    graph_add_edge(&g, 2, 1, 0.6f);
+    graph_add_edge(&g, 2, 3, 0.4f);
+    graph_add_edge(&g, 3, 4, 0.9f);
+    graph_add_edge(&g, 3, 3, 0.1f);
+    graph_add_edge(&g, 4, 3, 0.5f);
+    graph_add_edge(&g, 4, 5, 0.25f);
+    graph_add_edge(&g, 4, 7, 0.25f);
+    graph_add_edge(&g, 5, 5, 1.0f);
+    graph_add_edge(&g, 6, 7, 1.0f);
+    graph_add_edge(&g, 7, 6, 1.0f);
+
+    Partition P;
+    int *is_persistent = classify(&g, &P);
+    t_absorption a;
+    int rc = absorption_compute(&g, &P, is_persistent, ABSORB_TOL, ABSORB_MAX_ITER, &a);
+
+    check_int_equal("Convergence", rc, 1, failures);
+    check_int_equal("Etats transitoires", a.n_states, 4, failures);
+    check_int_equal("Sommes des lignes = 1", rows_sum_to_one(&a), 1, failures);
+    check_double_close("Ecart à la référence dense", max_error_vs_dense(&g, &P, &a), 0.0, EPS, failures);
+
+    // Depuis {3,4} : 3 -> 4 sûrement (hors boucle), puis 4 sort à moitié ;
+    // P(5 | 3) = P(7 | 3) = 1/2
+    int t5 = -1;
+    for (int t = 0; t < a.n_targets; ++t) {
+        if (a.target_class[t] == P.class_of[5]) t5 = t;
+    }
+    check_double_close("P({5} | 3)", absorption_prob(&a, 3, t5), 0.5, EPS, failures);
+
+    absorption_free(&a);
+    free(is_persistent);
+    scc_free_partition(&P);
+    graph_free(&g);
+}
+
+static void test_reachable_targets_only(int *failures)
+{
+    printf("\n--- TEST 3 : lignes limitées aux cibles atteignables, 2 -> {1},{3} ; 4 -> {5} ---\n");
+
+    AdjList g;
+    graph_init(&g, 5);
+    graph_add_edge(&g, 1, 1, 1.0f);
+    graph_add_edge(&g, 2, 1, 0.5f);
+    graph_add_edge(&g, 2, 3, 0.5f);
+    graph_add_edge(&g, 3, 3, 1.0f);
+    graph_add_edge(&g, 4, 4, 0.5f);
+    graph_add_edge(&g, 4, 5, 0.5f);
+    graph_add_edge(&g, 5, 5, 1.0f);
+
+    Partition P;
+    int *is_persistent = classify(&g, &P);
+    t_absorption a;
+    int rc = absorption_compute(&g, &P, is_persistent, ABSORB_TOL, ABSORB_MAX_ITER, &a);
+
+    check_int_equal("Convergence", rc, 1, failures);
+    check_int_equal("Cibles persistantes", a.n_targets, 3, failures);
+    check_int_equal("Entrées rangées (2 + 1)", (int)a.nnz, 3, failures);
+    int r4 = a.row_of[4];
+    check_int_equal("Entrées de l'état 4", (int)(a.row_ptr[r4 + 1] - a.row_ptr[r4]), 1, failures);
+    int t1 = -1, t5 = -1;
+    for (int t = 0; t < a.n_targets; ++t) {
+        if (a.target_class[t] == P.class_of[1]) t1 = t;
+        if (a.target_class[t] == P.class_of[5]) t5 = t;
+    }
+    check_double_close("P({5} | 4)", absorption_prob(&a, 4, t5), 1.0, EPS, failures);
+    check_double_close("P({1} | 4) non rangée", absorption_prob(&a, 4, t1), 0.0, 0.0, failures);
+    check_double_close("P({1} | 2)", absorption_prob(&a, 2, t1), 0.5, EPS, failures);
+    check_double_close("Temps moyen depuis 4", a.steps[r4], 2.0, EPS, failures);
+
+    absorption_free(&a);
+    free(is_persistent);
+    scc_free_partition(&P);
+    graph_free(&g);
+}
+
+static unsigned next_rand(unsigned *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+static void test_random_chain(int *failures)
+{
+    printf("\n--- TEST 4 : chaîne aléatoire de 300 états, blocs transitoires de 10 ---\n");
+
+    // Arcs arrière limités au bloc de 10 (une classe transitoire par bloc),
+    // arcs avant quelconques ; les 4 derniers états : absorbant 300, cycle
+    // {297, 298} et absorbant 299
+    const int n = 300;
+    unsigned seed = 7u;
+    AdjList g;
+    graph_init(&g, n);
+    for (int v = 1; v <= n - 4; ++v) {
+        int lo = ((v - 1) / 10) * 10 + 1;
+        int dest[4] = { v + 1, lo + (int)(next_rand(&seed) % 10u),
+                        v + 1 + (int)(next_rand(&seed) % (unsigned)(n - v)),
+                        n - 3 + (int)(next_rand(&seed) % 4u) };
+        if (dest[1] > n - 4) dest[1] = lo;
+        float w[4];
+        float sum = 0.0f;
+        for (int d = 0; d < 4; ++d) {
+            w[d] = 0.1f + (float)(next_rand(&seed) % 100u) / 100.0f;
+            if (d == 3) w[d] *= 0.05f;
+            for (int e = 0; e < d; ++e) {
+                if (dest[e] == dest[d]) w[d] = 0.0f;
+            }
+            sum += w[d];
+        }
+        for (int d = 0; d < 4; ++d) {
+            if (w[d] > 0.0f) graph_add_edge(&g, v, dest[d], w[d] / sum);
+        }
+    }
+    graph_add_edge(&g, n - 3, n - 2, 1.0f);
+    graph_add_edge(&g, n - 2, n - 3, 1.0f);
+    graph_add_edge(&g, n - 1, n - 1, 1.0f);
+    graph_add_edge(&g, n, n, 1.0f);
+
+    Partition P;
+    int *is_persistent = classify(&g, &P);
+    t_absorption a;
+    int rc = absorption_compute(&g, &P, is_persistent, ABSORB_TOL, ABSORB_MAX_ITER, &a);
+
+    check_int_equal("Convergence", rc, 1, failures);
+    check_int_equal("Etats transitoires", a.n_states, n - 4, failures);
+    check_int_equal("Cibles persistantes", a.n_targets, 3, failures);
+    check_int_equal("Sommes des lignes = 1", rows_sum_to_one(&a), 1, failures);
+    check_double_close("Ecart à la référence dense", max_error_vs_dense(&g, &P, &a), 0.0, EPS, failures);
+
+    absorption_free(&a);
+    free(is_persistent);
+    scc_free_partition(&P);
+    graph_free(&g);
+}
+
+static void test_multi_rhs_solver(int *failures)
+{
+    printf("\n--- TEST 5 : sp_solve_sor_multi contre sp_solve_sor colonne par colonne ---\n");
+
+    // A sous-stochastique 3×3 (ligne 3 fuit 0.3)
+    int64_t row_ptr[4] = { 0, 2, 4, 6 };
+    int col[6] = { 1, 2, 0, 2, 0, 1 };
+    float val[6] = { 0.5f, 0.5f, 0.4f, 0.4f, 0.3f, 0.4f };
+    t_spmatrix A = { 3, 6, row_ptr, col, val };
+
+    const double B[3][2] = { { 1.0, 0.0 }, { 0.0, 2.0 }, { 0.3, 1.0 } };
+    double X[3][2] = { { 0.0, 0.0 }, { 0.0, 0.0 }, { 0.0, 0.0 } };
+    t_solve_info info;
+    int rc = sp_solve_sor_multi(&A, &B[0][0], &X[0][0], 2, 1.0, 1e-12, 1000, &info);
+    check_int_equal("Convergence multi", rc, 1, failures);
+
+    for (int c = 0; c < 2; ++c) {
+        double b[3] = { B[0][c], B[1][c], B[2][c] };
+        double x[3] = { 0.0, 0.0, 0.0 };
+        sp_solve_sor(&A, b, x, 1.0, 1e-12, 1000, NULL);
+        for (int i = 0; i < 3; ++i) {
+            char label[64];
+            snprintf(label, sizeof(label), "X[%d][%d]", i, c);
+            check_double_close(label, X[i][c], x[i], 1e-9, failures);
+        }
+    }
+
+    // Pivot nul (A[0][0] = 1) : système refusé
+    float bad_val[6] = { 1.0f, 0.0f, 0.4f, 0.4f, 0.3f, 0.4f };
+    int bad_col[6] = { 0, 2, 0, 2, 0, 1 };
+    t_spmatrix Bad = { 3, 6, row_ptr, bad_col, bad_val };
+    check_int_equal("Pivot nul refusé", sp_solve_sor_multi(&Bad, &B[0][0], &X[0][0], 2, 1.0, 1e-12, 10, NULL), -1,
+                    failures);
+}
+
+int main(void)
+{
+    printf("=== TEST Partie 3 : absorption depuis les classes transitoires ===\n");
+
+    int failures = 0;
+
+    test_gambler_ruin(&failures);
+    test_chained_transient_classes(&failures);
+    test_reachable_targets_only(&failures);
+    test_random_chain(&failures);
+    test_multi_rhs_solver(&failures);
+
+    if (failures > 0) {
+        printf("\n=> ❌ %d test(s) échoué(s).\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("\n=> ✅ Tous les tests d'absorption ont réussi.\n");
+    return EXIT_SUCCESS;
+}
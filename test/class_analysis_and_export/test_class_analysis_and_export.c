@@ -152,6 +152,43 @@ static void test_absorbing_vertices(const Partition *P, const HasseLinkArray *L,
     }
 }
 
+/**
+ * @brief  Compare la table des propriétés de classes aux requêtes directes
+ *
+ * Vérifie tailles, persistance (contre markov_class_types) et caractère
+ * absorbant de chaque sommet 0..max_v (contre markov_is_absorbing_vertex).
+ *
+ * @param[in]  P              Partition en SCC
+ * @param[in]  L              Liens du Hasse
+ * @param[in]  is_persistent  Résultat de markov_class_types
+ * @param[in]  max_v          Plus grand sommet testé
+ *
+ * @return  1 si tout concorde, 0 sinon
+ */
+static int check_class_props(const Partition *P, const HasseLinkArray *L,
+                             const int *is_persistent, int max_v) {
+    t_class_props props;
+    markov_class_props_build(P, L, &props);
+    int ok = (props.nb_classes == P->count);
+
+    for (int k = 0; ok && k < P->count; ++k) {
+        if (props.size[k] != scc_class(P, k).count) ok = 0;
+        if (props.is_persistent[k] != is_persistent[k]) ok = 0;
+    }
+    for (int v = 0; ok && v <= max_v; ++v) {
+        if (markov_props_is_absorbing(&props, v) != markov_is_absorbing_vertex(P, L, v)) ok = 0;
+    }
+    // C1 -> C0 et C2 -> C3 : un seul lien sortant pour C1 et C2
+    if (ok && (props.out_degree[0] != 0 || props.out_degree[1] != 1 ||
+               props.out_degree[2] != 1 || props.out_degree[3] != 0)) ok = 0;
+    if (ok && (markov_props_class_of(&props, 24) != 0 || markov_props_class_of(&props, 5) != -1)) ok = 0;
+
+    printf("%s Table des propriétés de classes (taille, degré, persistance, absorbants)\n",
+           ok ? "[OK]" : "[FAIL]");
+    markov_class_props_free(&props);
+    return ok;
+}
+
 /**
  * @brief  Programme de test : analyse de classes et exports
  *
@@ -159,6 +196,7 @@ static void test_absorbing_vertices(const Partition *P, const HasseLinkArray *L,
  *  - `markov_class_types`
  *  - `markov_is_irreducible`
  *  - `markov_is_absorbing_vertex` sur quelques sommets
+ *  - la table `t_class_props` contre les requêtes directes
  * puis exporte en Mermaid (.mmd) et texte (.txt), avant nettoyage.
  *
  * @return  Code de retour du processus (0 si succès)
@@ -202,6 +240,7 @@ int main(void) {
     const int sample_vertices[] = { 35, 3, 24, 7 };
     printf("Vérification des états absorbants sur {35, 3, 24, 7} :\n");
     test_absorbing_vertices(&P, &L, sample_vertices, (int)(sizeof(sample_vertices)/sizeof(sample_vertices[0])));
+    int props_ok = check_class_props(&P, &L, is_persistent, 40);
 
     // 5) Tester les exports
     //    Créer le dossier 'out' si besoin (comme dans Partie 1)
@@ -230,5 +269,5 @@ int main(void) {
     // (sinon : if (L.links) free(L.links);)
 
     printf("=== FIN TEST class_analysis_and_export ===\n");
-    return 0;
+    return props_ok ? 0 : 1;
 }
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "graph_gen.h"
+
+// Alloue un graphe CSR à n sommets pouvant contenir nnz arêtes
+static void graph_alloc(AdjList *g, int n, int64_t nnz) {
+    graph_init(g, n);
+    graph_reserve(g, nnz > 0 ? nnz : 1);
+}
+
+void gen_random(AdjList *g, int n, int deg, unsigned seed) {
+    graph_alloc(g, n, (int64_t)n * deg);
+    int64_t k = 0;
+    for (int i = 1; i <= n; ++i) {
+        g->offsets[i - 1] = k;
+        for (int d = 0; d < deg; ++d) {
+            g->dests[k] = 1 + (int)(gen_next_rand(&seed) % (unsigned)n);
+            g->probas[k++] = 1.0f / (float)deg;
+        }
+    }
+    g->offsets[n] = k;
+    g->nnz = k;
+}
+
+/**
+ * @brief  Anneaux de taille 'ring' reliés en DAG, sommets renumérotés au hasard
+ *
+ * Chaque sommet suit son anneau et, une fois sur deux, pointe vers un anneau
+ * d'indice supérieur : nombreuses CFC moyennes, rien à élaguer (exerce la
+ * coloration).
+ */
+void gen_rings(AdjList *g, int nrings, int ring, unsigned seed) {
+    int n = nrings * ring;
+    int *perm = (int *)malloc((size_t)n * sizeof(int));
+    // inv[id] : position (anneau * ring + rang) du sommet id
+    int *inv = (int *)malloc((size_t)n * sizeof(int));
+    if (!perm || !inv) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; ++i) perm[i] = i;
+    for (int i = n - 1; i > 0; --i) {
+        int j = (int)(gen_next_rand(&seed) % (unsigned)(i + 1));
+        int t = perm[i]; perm[i] = perm[j]; perm[j] = t;
+    }
+    for (int i = 0; i < n; ++i) inv[perm[i]] = i;
+
+    graph_alloc(g, n, 2 * (int64_t)n);
+    int64_t k = 0;
+    for (int id = 0; id < n; ++id) {
+        int pos = inv[id];
+        int r = pos / ring, s = pos % ring;
+        g->offsets[id] = k;
+        g->dests[k] = perm[r * ring + (s + 1) % ring] + 1;
+        g->probas[k++] = 0.5f;
+        if (r + 1 < nrings && gen_next_rand(&seed) % 2u == 0u) {
+            int r2 = r + 1 + (int)(gen_next_rand(&seed) % (unsigned)(nrings - r - 1));
+            g->dests[k] = perm[r2 * ring + (int)(gen_next_rand(&seed) % (unsigned)ring)] + 1;
+            g->probas[k++] = 0.5f;
+        }
+    }
+    g->offsets[n] = k;
+    g->nnz = k;
+    free(perm);
+    free(inv);
+}
+
+void gen_dag_chain(AdjList *g, int n) {
+    graph_alloc(g, n, n);
+    int64_t k = 0;
+    for (int i = 1; i <= n; ++i) {
+        g->offsets[i - 1] = k;
+        if (i < n) {
+            g->dests[k] = i + 1;
+            g->probas[k++] = 1.0f;
+        }
+    }
+    g->offsets[n] = k;
+    g->nnz = k;
+}
+
+void gen_dag_shortcuts(AdjList *g, int n, int deg, unsigned seed) {
+    graph_alloc(g, n, (int64_t)n * deg);
+    int64_t k = 0;
+    for (int i = 1; i <= n; ++i) {
+        g->offsets[i - 1] = k;
+        for (int d = 0; d < deg && i < n; ++d) {
+            unsigned r = gen_next_rand(&seed);
+            g->dests[k] = d == 0 ? i + 1 : i + 1 + (int)(r % (unsigned)(n - i));
+            g->probas[k++] = 1.0f / (float)deg;
+        }
+    }
+    g->offsets[n] = k;
+    g->nnz = k;
+}
+
+// L'arête vers i+1 est listée en premier : le parcours en profondeur descend
+// jusqu'à n
+void gen_birth_death(AdjList *g, int n) {
+    graph_alloc(g, n, 2 * (int64_t)n);
+    int64_t k = 0;
+    for (int i = 1; i <= n; ++i) {
+        g->offsets[i - 1] = k;
+        g->dests[k] = i < n ? i + 1 : i;
+        g->probas[k++] = 0.5f;
+        g->dests[k] = i > 1 ? i - 1 : i;
+        g->probas[k++] = 0.5f;
+    }
+    g->offsets[n] = k;
+    g->nnz = k;
+}
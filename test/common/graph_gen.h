@@ -0,0 +1,30 @@
+#ifndef GRAPH_GEN_H
+#define GRAPH_GEN_H
+#include "graph.h"
+
+// Générateurs de graphes CSR partagés par les tests et les benchmarks de CFC.
+// Tous déterministes : une même graine donne le même graphe.
+
+// Générateur pseudo-aléatoire (LCG) utilisé par les constructions ci-dessous
+// et par les benchmarks (en ligne : utilisable sans lier graph_gen.c)
+static inline unsigned gen_next_rand(unsigned *seed) {
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+// Graphe pseudo-aléatoire : 'deg' arêtes sortantes par sommet
+void gen_random(AdjList *g, int n, int deg, unsigned seed);
+
+// Anneaux de taille 'ring' reliés en DAG, sommets renumérotés au hasard
+void gen_rings(AdjList *g, int nrings, int ring, unsigned seed);
+
+// Chaîne orientée 1 -> 2 -> ... -> n (n CFC triviales)
+void gen_dag_chain(AdjList *g, int n);
+
+// Chaîne orientée 1 -> ... -> n avec 'deg'-1 raccourcis aléatoires vers l'avant
+void gen_dag_shortcuts(AdjList *g, int n, int deg, unsigned seed);
+
+// Chaîne de naissance-mort 1 <-> ... <-> n (une seule CFC, profondeur n)
+void gen_birth_death(AdjList *g, int n);
+
+#endif
@@ -5,7 +5,7 @@
  * @brief Programme de démonstration (Partie 1 - Etape 1) pour l'utilisation des fonctions de gestion de graphe.
  */
 int main(void) {
-    printf("=== TEST Partie 1.1 : core (graph/list) ===\n");
+    printf("=== TEST Partie 1.1 : core (graph CSR) ===\n");
     AdjList g;
     // 1. Initialisation du graphe pour 4 sommets (états). Les sommets seront numérotés 1 à 4.
     graph_init(&g, 4);
@@ -4,6 +4,7 @@
 #include "scc.h"      // Définitions pour la Partition (Partition, SccClass)
 #include "tarjan.h"   // Fonction d'identification des SCC (tarjan_partition)
 #include "hasse.h"    // Fonctions pour le graphe de condensation (HasseLinkArray, build_class_links)
+#include "graph_gen.h" // Générateurs de graphes partagés (gen_random)
 
 /**
  * @brief Affiche le contenu de la partition (la liste des Composantes Fortement Connexes ou SCCs).
@@ -16,8 +17,8 @@ static void print_partition(const Partition *p) {
     for (int i = 0; i < p->count; i++) {
         printf("Classe %d: ", i);
         // Itère sur les sommets contenus dans la classe actuelle
-        for (int j = 0; j < p->classes[i].count; j++) {
-            printf("%d ", p->classes[i].verts[j]); // Affiche l'indice du sommet (probablement 1-basé)
+        for (int j = 0; j < scc_class(p, i).count; j++) {
+            printf("%d ", scc_class(p, i).verts[j]); // Affiche l'indice du sommet (probablement 1-basé)
         }
         printf("\n");
     }
@@ -37,6 +38,305 @@ static void print_links(const HasseLinkArray *arr) {
     }
 }
 
+/**
+ * @brief Vérifie un graphe de condensation contre une matrice classe x classe.
+ *
+ * Liens attendus : une case par couple (classe de v, classe de w) distinctes
+ * pour chaque arête v -> w. Vérifie aussi que C->topo est une permutation où
+ * chaque lien va vers une classe placée plus loin.
+ *
+ * @return 1 si correct, 0 sinon.
+ */
+static int condensation_ok(const AdjList *g, const Partition *p, const t_condensation *C) {
+    int nc = p->count;
+    if (C->n != nc) return 0;
+    char *expected = calloc((size_t)nc * nc, 1);
+    char *seen = calloc((size_t)nc * nc, 1);
+    int *pos = malloc((size_t)nc * sizeof(int));
+    int ok = expected && seen && pos;
+
+    int64_t n_expected = 0;
+    for (int v = 1; ok && v <= g->size; ++v) {
+        for (int64_t k = g->offsets[v - 1]; k < g->offsets[v]; ++k) {
+            int a = p->class_of[v], b = p->class_of[g->dests[k]];
+            if (a != b && !expected[(size_t)a * nc + b]) {
+                expected[(size_t)a * nc + b] = 1;
+                n_expected++;
+            }
+        }
+    }
+    ok = ok && C->nnz == n_expected;
+    for (int c = 0; ok && c < nc; ++c) {
+        for (int64_t k = C->offsets[c]; ok && k < C->offsets[c + 1]; ++k) {
+            size_t cell = (size_t)c * nc + C->succ[k];
+            if (!expected[cell] || seen[cell]) ok = 0; // lien absent ou en double
+            seen[cell] = 1;
+        }
+    }
+
+    for (int i = 0; ok && i < nc; ++i) pos[i] = -1;
+    for (int i = 0; ok && i < nc; ++i) {
+        int c = C->topo[i];
+        if (c < 0 || c >= nc || pos[c] >= 0) ok = 0;
+        else pos[c] = i;
+    }
+    for (int c = 0; ok && c < nc; ++c) {
+        for (int64_t k = C->offsets[c]; ok && k < C->offsets[c + 1]; ++k) {
+            if (pos[C->succ[k]] <= pos[c]) ok = 0;
+        }
+    }
+
+    free(expected);
+    free(seen);
+    free(pos);
+    return ok;
+}
+
+/**
+ * @brief Teste build_condensation sur des graphes aléatoires.
+ *
+ * Partition de Tarjan (ordre topologique déduit de l'ordre des classes) puis
+ * même partition avec des classes mélangées (ordre calculé par Kahn).
+ *
+ * @return Nombre d'échecs.
+ */
+static int check_condensation(void) {
+    int failures = 0;
+    for (int deg = 1; deg <= 3; ++deg) {
+        for (unsigned seed = 1; seed <= 4; ++seed) {
+            AdjList g;
+            gen_random(&g, 1500, deg, seed);
+            Partition p;
+            scc_init_partition(&p);
+            tarjan_partition(&g, &p);
+
+            t_condensation C;
+            build_condensation(&g, &p, &C);
+            if (!condensation_ok(&g, &p, &C)) {
+                printf("  [FAIL] condensation (Tarjan) degré %d graine %u\n", deg, seed);
+                failures++;
+            }
+            condensation_free(&C);
+
+            // Classes mélangées : classe k -> position (k * 7919) mod count, si inversible
+            Partition q;
+            scc_init_partition(&q);
+            int step = p.count % 7919 ? 7919 : 1;
+            for (int i = 0; i < p.count; ++i) {
+                SccClass src = scc_class(&p, (int)(((int64_t)i * step) % p.count));
+                SccClass cls = scc_make_empty_class();
+                for (int j = 0; j < src.count; ++j) scc_add_vertex(&cls, src.verts[j]);
+                scc_add_class(&q, cls);
+            }
+            build_condensation(&g, &q, &C);
+            if (!condensation_ok(&g, &q, &C)) {
+                printf("  [FAIL] condensation (classes mélangées) degré %d graine %u\n", deg, seed);
+                failures++;
+            }
+            condensation_free(&C);
+
+            scc_free_partition(&q);
+            scc_free_partition(&p);
+            graph_free(&g);
+        }
+    }
+    printf("  [%s] condensation sans doublon, ordre topologique valide (graphes aléatoires)\n",
+           failures ? "FAIL" : "OK");
+    return failures;
+}
+
+/**
+ * @brief Vérifie les agrégats des liens (probabilité totale, nombre d'arcs, flux).
+ *
+ * Référence : accumulation directe sur toutes les arêtes dans des matrices
+ * classe x classe, poids des sommets pseudo-aléatoires.
+ *
+ * @return Nombre d'échecs.
+ */
+static int check_link_weights(void) {
+    int failures = 0;
+    for (unsigned seed = 1; seed <= 4; ++seed) {
+        AdjList g;
+        gen_random(&g, 800, 1 + (int)seed % 3, seed);
+        Partition p;
+        scc_init_partition(&p);
+        tarjan_partition(&g, &p);
+        int nc = p.count;
+
+        float *w = malloc((size_t)g.size * sizeof(float));
+        unsigned r = seed;
+        for (int v = 0; v < g.size; ++v) {
+            r = r * 1103515245u + 12345u;
+            w[v] = (float)((r >> 8) % 1000u) / 1000.0f;
+        }
+        double *proba = calloc((size_t)nc * nc, sizeof(double));
+        double *flow = calloc((size_t)nc * nc, sizeof(double));
+        int64_t *edges = calloc((size_t)nc * nc, sizeof(int64_t));
+        for (int v = 1; v <= g.size; ++v) {
+            for (int64_t k = g.offsets[v - 1]; k < g.offsets[v]; ++k) {
+                int a = p.class_of[v], b = p.class_of[g.dests[k]];
+                if (a == b) continue;
+                size_t cell = (size_t)a * nc + b;
+                proba[cell] += g.probas[k];
+                flow[cell] += (double)w[v - 1] * g.probas[k];
+                edges[cell]++;
+            }
+        }
+
+        HasseLinkArray L;
+        hasse_init_links(&L);
+        build_class_links_weighted(&g, &p, w, &L);
+        int ok = L.weighted && L.has_flow;
+        for (int i = 0; ok && i < L.count; ++i) {
+            size_t cell = (size_t)L.links[i].from_class * nc + L.links[i].to_class;
+            ok = L.links[i].edges == edges[cell]
+              && L.links[i].proba > proba[cell] - 1e-9 && L.links[i].proba < proba[cell] + 1e-9
+              && L.links[i].flow > flow[cell] - 1e-9 && L.links[i].flow < flow[cell] + 1e-9;
+        }
+        if (!ok) {
+            printf("  [FAIL] agrégats des liens, graine %u\n", seed);
+            failures++;
+        }
+
+        hasse_free_links(&L);
+        free(proba);
+        free(flow);
+        free(edges);
+        free(w);
+        scc_free_partition(&p);
+        graph_free(&g);
+    }
+    printf("  [%s] liens pondérés : probabilité totale, nombre d'arcs et flux exacts\n", failures ? "FAIL" : "OK");
+    return failures;
+}
+
+/**
+ * @brief Réduction transitive de référence (Floyd-Warshall sur matrice d'int, version d'origine).
+ *
+ * @return Tableau keep[i] (1 si le lien i est conservé), à libérer.
+ */
+static int *reference_reduction(const HasseLinkArray *links, int nb_classes) {
+    int **reach = malloc(nb_classes * sizeof(int *));
+    for (int i = 0; i < nb_classes; i++) reach[i] = calloc(nb_classes, sizeof(int));
+    for (int i = 0; i < links->count; i++) {
+        reach[links->links[i].from_class][links->links[i].to_class] = 1;
+    }
+    for (int k = 0; k < nb_classes; k++)
+        for (int i = 0; i < nb_classes; i++)
+            for (int j = 0; j < nb_classes; j++)
+                if (reach[i][k] && reach[k][j]) reach[i][j] = 1;
+
+    int *keep = malloc((size_t)(links->count > 0 ? links->count : 1) * sizeof(int));
+    for (int i = 0; i < links->count; i++) {
+        int from = links->links[i].from_class, to = links->links[i].to_class;
+        keep[i] = 1;
+        for (int k = 0; k < nb_classes; k++) {
+            if (k != from && k != to && reach[from][k] && reach[k][to]) {
+                keep[i] = 0;
+                break;
+            }
+        }
+    }
+    for (int i = 0; i < nb_classes; i++) free(reach[i]);
+    free(reach);
+    return keep;
+}
+
+// Liens aléatoires entre nb_classes classes ; 'dag' : uniquement from < to (doublons possibles)
+static void random_links(HasseLinkArray *L, int nb_classes, int count, int dag, unsigned seed) {
+    hasse_init_links(L);
+    L->links = malloc((size_t)count * sizeof(HasseLink));
+    L->capacity = count;
+    while (L->count < count) {
+        seed = seed * 1103515245u + 12345u;
+        int a = (int)((seed >> 8) % (unsigned)nb_classes);
+        seed = seed * 1103515245u + 12345u;
+        int b = (int)((seed >> 8) % (unsigned)nb_classes);
+        if (a == b) continue;
+        if (dag && a > b) { int t = a; a = b; b = t; }
+        L->links[L->count].from_class = a;
+        L->links[L->count].to_class = b;
+        L->count++;
+    }
+}
+
+// Compare une réduction (variant 0 : remove_transitive_links, 1 : _lowmem) à la référence
+static int same_reduction(const HasseLinkArray *orig, int nb_classes, int variant) {
+    HasseLinkArray L;
+    hasse_init_links(&L);
+    L.links = malloc((size_t)orig->count * sizeof(HasseLink));
+    L.capacity = orig->count;
+    L.count = orig->count;
+    for (int i = 0; i < orig->count; i++) L.links[i] = orig->links[i];
+
+    if (variant == 0) remove_transitive_links(&L, nb_classes);
+    else remove_transitive_links_lowmem(&L, nb_classes);
+
+    int *keep = reference_reduction(orig, nb_classes);
+    int ok = 1, j = 0;
+    for (int i = 0; i < orig->count && ok; i++) {
+        if (!keep[i]) continue;
+        ok = j < L.count && L.links[j].from_class == orig->links[i].from_class
+                         && L.links[j].to_class == orig->links[i].to_class;
+        j++;
+    }
+    ok = ok && j == L.count;
+    free(keep);
+    hasse_free_links(&L);
+    return ok;
+}
+
+/**
+ * @brief Compare la réduction transitive à la version d'origine (Floyd-Warshall).
+ *
+ * Liens aléatoires formant un DAG (bitsets, puis parcours à mémoire réduite),
+ * liens avec cycles (cas général), liens réels d'un graphe de condensation.
+ *
+ * @return Nombre d'échecs.
+ */
+static int check_transitive_reduction(void) {
+    int failures = 0;
+    for (unsigned seed = 1; seed <= 6; ++seed) {
+        HasseLinkArray L;
+        int nb = 40 + 30 * (int)seed;
+        random_links(&L, nb, 4 * nb, 1, seed);
+        for (int variant = 0; variant < 2; ++variant) {
+            if (!same_reduction(&L, nb, variant)) {
+                printf("  [FAIL] réduction DAG (%s) graine %u\n", variant ? "lowmem" : "bitsets", seed);
+                failures++;
+            }
+        }
+        hasse_free_links(&L);
+
+        random_links(&L, 30, 45, 0, seed);
+        if (!same_reduction(&L, 30, 0)) {
+            printf("  [FAIL] réduction avec cycles graine %u\n", seed);
+            failures++;
+        }
+        hasse_free_links(&L);
+
+        AdjList g;
+        gen_random(&g, 600, 1 + (int)(seed % 3), seed);
+        Partition p;
+        scc_init_partition(&p);
+        tarjan_partition(&g, &p);
+        hasse_init_links(&L);
+        build_class_links(&g, &p, &L);
+        for (int variant = 0; variant < 2; ++variant) {
+            if (!same_reduction(&L, p.count, variant)) {
+                printf("  [FAIL] réduction de la condensation (%s) graine %u\n", variant ? "lowmem" : "bitsets", seed);
+                failures++;
+            }
+        }
+        hasse_free_links(&L);
+        scc_free_partition(&p);
+        graph_free(&g);
+    }
+    printf("  [%s] réduction transitive identique à Floyd-Warshall (DAG, cycles, condensation)\n",
+           failures ? "FAIL" : "OK");
+    return failures;
+}
+
 /**
  * @brief Fonction principale de démonstration pour la décomposition en classes (SCC)
  * et la construction du graphe de Hasse.
@@ -69,7 +369,7 @@ int main(void) {
     tarjan_partition(&g, &p);
     print_partition(&p); // Affiche le résultat de la partition
 
-    HasseLinkArray links = {NULL, 0, 0}; // Initialisation manuelle des liens
+    HasseLinkArray links = {NULL, 0, 0, 0, 0}; // Initialisation manuelle des liens
     
     // Construction des liens entre les classes (graphe de condensation)
     build_class_links(&g, &p, &links);
@@ -79,6 +379,22 @@ int main(void) {
     hasse_free_links(&links); // Libère les liens de Hasse
     scc_free_partition(&p);   // Libère la partition des SCCs
     graph_free(&g);           // Libère le graphe d'adjacence
+
+    printf("\n[Test] Graphe de condensation :\n");
+    if (check_condensation() > 0) {
+        printf("=> Graphe de condensation en échec.\n");
+        return EXIT_FAILURE;
+    }
+    printf("\n[Test] Liens pondérés :\n");
+    if (check_link_weights() > 0) {
+        printf("=> Liens pondérés en échec.\n");
+        return EXIT_FAILURE;
+    }
+    printf("\n[Test] Réduction transitive :\n");
+    if (check_transitive_reduction() > 0) {
+        printf("=> Réduction transitive en échec.\n");
+        return EXIT_FAILURE;
+    }
     printf("=== FIN TEST hasse_links ===\n");
     return 0;
 }
@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph.h"
+#include "scc.h"
+#include "tarjan.h"
+#include "io.h"
+#include "hitting.h"
+
+static const double EPS = 1e-6;
+
+static double dabs(double v)
+{
+    return v < 0.0 ? -v : v;
+}
+
+static void check_int_equal(const char *label, int got, int expected, int *failures)
+{
+    if (got == expected) {
+        printf("  [OK]   %s (attendu=%d, obtenu=%d)\n", label, expected, got);
+    } else {
+        printf("  [FAIL] %s (attendu=%d, obtenu=%d)\n", label, expected, got);
+        (*failures)++;
+    }
+}
+
+static void check_double_close(const char *label, double got, double expected, double tol, int *failures)
+{
+    if (dabs(got - expected) <= tol) {
+        printf("  [OK]   %s (attendu=%.6f, obtenu=%.6f)\n", label, expected, got);
+    } else {
+        printf("  [FAIL] %s (attendu=%.6f, obtenu=%.6f)\n", label, expected, got);
+        (*failures)++;
+    }
+}
+
+/**
+ * @brief  Partition de Tarjan puis temps d'atteinte de la liste de cibles
+ *
+ * @return  Code de retour de hitting_times
+ */
+static int run_hitting(const AdjList *g, const char *targets, double *h, unsigned char *status,
+                       t_solve_info *info)
+{
+    Partition P;
+    scc_init_partition(&P);
+    tarjan_partition(g, &P);
+    unsigned char *is_target = calloc((size_t)g->size + 1, 1);
+    parse_vertex_set(targets, g->size, "--hitting-times", is_target);
+    int rc = hitting_times(g, &P, is_target, HIT_TOL, HIT_MAX_ITER, h, status, info);
+    free(is_target);
+    scc_free_partition(&P);
+    return rc;
+}
+
+static void test_reflecting_walk(int *failures)
+{
+    printf("\n--- TEST 1 : marche symétrique sur 1..5, réfléchie en 1, cible 5 ---\n");
+
+    AdjList g;
+    graph_init(&g, 5);
+    graph_add_edge(&g, 1, 2, 1.0f);
+    for (int v = 2; v <= 4; ++v) {
+        graph_add_edge(&g, v, v - 1, 0.5f);
+        graph_add_edge(&g, v, v + 1, 0.5f);
+    }
+    graph_add_edge(&g, 5, 4, 1.0f);
+
+    double h[6];
+    unsigned char status[6];
+    t_solve_info info;
+    int rc = run_hitting(&g, "5", h, status, &info);
+    check_int_equal("Convergence", rc, 1, failures);
+
+    // h(v) = 16 - (v-1)^2
+    for (int v = 1; v <= 5; ++v) {
+        char label[64];
+        snprintf(label, sizeof(label), "h(%d)", v);
+        check_double_close(label, h[v], 16.0 - (double)((v - 1) * (v - 1)), EPS, failures);
+    }
+    check_int_equal("Statut de 5", status[5], HIT_TARGET, failures);
+    check_int_equal("Statut de 1", status[1], HIT_FINITE, failures);
+
+    graph_free(&g);
+}
+
+static void test_status_classification(int *failures)
+{
+    printf("\n--- TEST 2 : sommets écartés (classe sans cible, fuite possible) ---\n");
+
+    // {1,2} -> 3 cible, {1,2} -> {4} absorbant sans cible ; 5 -> 1 ; 6 -> 3
+    AdjList g;
+    graph_init(&g, 6);
+    graph_add_edge(&g, 1, 2, 0.5f);
+    graph_add_edge(&g, 1, 3, 0.25f);
+    graph_add_edge(&g, 1, 4, 0.25f);
+    graph_add_edge(&g, 2, 1, 1.0f);
+    graph_add_edge(&g, 3, 3, 1.0f);
+    graph_add_edge(&g, 4, 4, 1.0f);
+    graph_add_edge(&g, 5, 1, 1.0f);
+    graph_add_edge(&g, 6, 3, 0.5f);
+    graph_add_edge(&g, 6, 6, 0.5f);
+
+    double h[7];
+    unsigned char status[7];
+    t_solve_info info;
+    int rc = run_hitting(&g, "3", h, status, &info);
+    check_int_equal("Convergence", rc, 1, failures);
+    check_int_equal("Statut de 1 (fuite vers 4)", status[1], HIT_ESCAPE, failures);
+    check_int_equal("Statut de 2 (via 1)", status[2], HIT_ESCAPE, failures);
+    check_int_equal("Statut de 5 (via 1)", status[5], HIT_ESCAPE, failures);
+    check_int_equal("Statut de 4 (classe sans cible)", status[4], HIT_UNREACHABLE, failures);
+    check_int_equal("Statut de 3", status[3], HIT_TARGET, failures);
+    check_int_equal("Statut de 6", status[6], HIT_FINITE, failures);
+    check_double_close("h(6) (géométrique de paramètre 1/2)", h[6], 2.0, EPS, failures);
+
+    // Aucune fuite quand 4 est aussi une cible
+    rc = run_hitting(&g, "3-4", h, status, &info);
+    check_int_equal("Statut de 5, cibles {3,4}", status[5], HIT_FINITE, failures);
+    // h(1) = 1 + h(2)/2, h(2) = 1 + h(1) => h(1) = 3, h(5) = 4
+    check_double_close("h(5), cibles {3,4}", h[5], 4.0, EPS, failures);
+
+    graph_free(&g);
+}
+
+static unsigned next_rand(unsigned *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+/**
+ * @brief  Référence dense : élimination de Gauss sur les sommets finis
+ *
+ * @return  Plus grand écart relatif à h
+ */
+static double max_error_vs_dense(const AdjList *g, const unsigned char *status, const double *h)
+{
+    int n = g->size;
+    int *row = malloc(((size_t)n + 1) * sizeof(int));
+    int m = 0;
+    for (int v = 1; v <= n; ++v) row[v] = (status[v] == HIT_FINITE) ? m++ : -1;
+    int w = m + 1;
+    double *M = calloc((size_t)m * w, sizeof(double));
+    for (int v = 1; v <= n; ++v) {
+        if (row[v] < 0) continue;
+        double *r = M + (size_t)row[v] * w;
+        r[row[v]] += 1.0;
+        r[m] = 1.0;
+        for (int64_t e = g->offsets[v - 1]; e < g->offsets[v]; ++e) {
+            if (row[g->dests[e]] >= 0) r[row[g->dests[e]]] -= g->probas[e];
+        }
+    }
+    for (int c = 0; c < m; ++c) {
+        int piv = c;
+        for (int r = c + 1; r < m; ++r) {
+            if (dabs(M[(size_t)r * w + c]) > dabs(M[(size_t)piv * w + c])) piv = r;
+        }
+        for (int j = 0; j < w && piv != c; ++j) {
+            double tmp = M[(size_t)c * w + j];
+            M[(size_t)c * w + j] = M[(size_t)piv * w + j];
+            M[(size_t)piv * w + j] = tmp;
+        }
+        for (int r = 0; r < m; ++r) {
+            double f = (r == c) ? 0.0 : M[(size_t)r * w + c] / M[(size_t)c * w + c];
+            if (f == 0.0) continue;
+            for (int j = c; j < w; ++j) M[(size_t)r * w + j] -= f * M[(size_t)c * w + j];
+        }
+    }
+    double err = 0.0;
+    for (int v = 1; v <= n; ++v) {
+        if (row[v] < 0) continue;
+        double ref = M[(size_t)row[v] * w + m] / M[(size_t)row[v] * w + row[v]];
+        double e = dabs(ref - h[v]) / (ref > 1.0 ? ref : 1.0);
+        if (e > err) err = e;
+    }
+    free(M);
+    free(row);
+    return err;
+}
+
+static void test_random_chain(int *failures)
+{
+    printf("\n--- TEST 3 : graphe aléatoire de 400 sommets, cibles 1-5 ---\n");
+
+    const int n = 400;
+    unsigned seed = 3u;
+    AdjList g;
+    graph_init(&g, n);
+    for (int v = 1; v <= n; ++v) {
+        int dest[3] = { v % n + 1, 1 + (int)(next_rand(&seed) % (unsigned)n),
+                        1 + (int)(next_rand(&seed) % (unsigned)n) };
+        float sum = 0.0f, wgt[3];
+        for (int d = 0; d < 3; ++d) {
+            wgt[d] = 0.2f + (float)(next_rand(&seed) % 100u) / 100.0f;
+            for (int e = 0; e < d; ++e) {
+                if (dest[e] == dest[d]) wgt[d] = 0.0f;
+            }
+            sum += wgt[d];
+        }
+        for (int d = 0; d < 3; ++d) {
+            if (wgt[d] > 0.0f) graph_add_edge(&g, v, dest[d], wgt[d] / sum);
+        }
+    }
+
+    double *h = malloc(((size_t)n + 1) * sizeof(double));
+    unsigned char *status = malloc((size_t)n + 1);
+    t_solve_info info;
+    int rc = run_hitting(&g, "1-5", h, status, &info);
+    check_int_equal("Convergence", rc, 1, failures);
+    int finite = 0;
+    for (int v = 1; v <= n; ++v) finite += (status[v] == HIT_FINITE);
+    check_int_equal("Sommets finis (graphe irréductible)", finite, n - 5, failures);
+    check_double_close("Ecart à la référence dense", max_error_vs_dense(&g, status, h), 0.0, EPS, failures);
+
+    free(status);
+    free(h);
+    graph_free(&g);
+}
+
+int main(void)
+{
+    printf("=== TEST Partie 3 : temps moyens d'atteinte (--hitting-times) ===\n");
+
+    int failures = 0;
+
+    test_reflecting_walk(&failures);
+    test_status_classification(&failures);
+    test_random_chain(&failures);
+
+    if (failures > 0) {
+        printf("\n=> ❌ %d test(s) échoué(s).\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("\n=> ✅ Tous les tests de temps d'atteinte ont réussi.\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+// Tests unitaires pour le format binaire .mgb (écriture + relecture) sur tous les fichiers data/*.txt
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "io.h"
+#include "graph.h"
+#include "utils.h"
+
+#ifndef DATA_DIR
+#error DATA_DIR doit être défini (par CMakeLists)
+#endif
+
+#define MGB_FILE "out/io_binary_test.mgb"
+#define MGB_BAD_FILE "out/io_binary_bad.mgb"
+
+static int ends_with_txt(const char *name) {
+    size_t n = strlen(name);
+    return n >= 4 && strcmp(name + (n - 4), ".txt") == 0;
+}
+
+// Compare deux graphes arête par arête (ordre des listes compris)
+static int same_graph(const AdjList *a, const AdjList *b) {
+    if (a->size != b->size) return 0;
+    for (int i = 0; i < a->size; ++i) {
+        if (a->offsets[i + 1] - a->offsets[i] != b->offsets[i + 1] - b->offsets[i]) return 0;
+        for (int64_t k = a->offsets[i], l = b->offsets[i]; k < a->offsets[i + 1]; ++k, ++l) {
+            if (a->dests[k] != b->dests[l] || a->probas[k] != b->probas[l]) return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief  En-tête forgé : nnz = 2^62, nnz × 8 déborde à 0 sur 64 bits
+ *
+ * Le fichier (en-tête + offsets) a exactement la taille « attendue » après
+ * débordement. La lecture doit refuser l'en-tête (sortie EXIT_FAILURE) et
+ * non lire hors de la projection (signal). Lecture dans un processus fils,
+ * read_graph_from_file quittant sur erreur.
+ *
+ * @return  1 si le fichier est refusé proprement, 0 sinon
+ */
+static int rejects_overflowing_header(void) {
+    FILE *f = fopen(MGB_BAD_FILE, "wb");
+    if (!f) return 0;
+    const uint32_t version = 1u, endian = 0x01020304u;
+    const int32_t n = 1;
+    const int64_t nnz = INT64_C(1) << 62, reserved = 0;
+    const int64_t offsets[2] = {0, nnz};
+    fwrite("MGB\x1a", 1, 4, f);
+    fwrite(&version, sizeof(version), 1, f);
+    fwrite(&endian, sizeof(endian), 1, f);
+    fwrite(&n, sizeof(n), 1, f);
+    fwrite(&nnz, sizeof(nnz), 1, f);
+    fwrite(&reserved, sizeof(reserved), 1, f);
+    fwrite(offsets, sizeof(offsets), 1, f);
+    fclose(f);
+
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) return 0;
+    if (pid == 0) {
+        AdjList g;
+        freopen("/dev/null", "w", stderr);
+        read_graph_from_file(MGB_BAD_FILE, &g);
+        _exit(0); // accepté : échec du test
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    remove(MGB_BAD_FILE);
+    return WIFEXITED(status) && WEXITSTATUS(status) == EXIT_FAILURE;
+}
+
+int main(void) {
+    printf("=== TEST Partie 1.2 ter : io_binary (format .mgb) ===\n");
+
+    if (ensure_dir("out") != 0) {
+        perror("ensure_dir(out)");
+        return 1;
+    }
+
+    DIR *dir = opendir(DATA_DIR);
+    if (!dir) {
+        perror("opendir(DATA_DIR)");
+        return 1;
+    }
+
+    int total = 0;
+    int failures = 0;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL) {
+        const char *name = ent->d_name;
+        if (name[0] == '.' || !ends_with_txt(name)) continue;
+
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", DATA_DIR, name);
+        total++;
+
+        // Texte -> binaire -> relecture (détection automatique du format)
+        AdjList txt;
+        read_graph_from_file(path, &txt);
+        int wrote = write_graph_binary(&txt, MGB_FILE) == 0;
+
+        AdjList bin;
+        read_graph_from_file(MGB_FILE, &bin);
+        int same = wrote && same_graph(&txt, &bin);
+
+        printf("  [%s] %s (N=%d)\n", same ? "OK" : "FAIL", name, txt.size);
+        if (!same) failures++;
+
+        graph_free(&bin);
+        graph_free(&txt);
+    }
+    closedir(dir);
+    remove(MGB_FILE);
+
+    int bad_ok = rejects_overflowing_header();
+    printf("  [%s] en-tête forgé (nnz = 2^62) refusé sans lecture hors bornes\n", bad_ok ? "OK" : "FAIL");
+    if (!bad_ok) failures++;
+
+    printf("\n[RÉSUMÉ] fichiers=%d échecs=%d\n", total, failures);
+    if (failures > 0) {
+        return EXIT_FAILURE;
+    }
+    printf("=== FIN TEST io_binary ===\n");
+    return 0;
+}
@@ -0,0 +1,135 @@
+// Tests unitaires pour la lecture multi-thread (read_graph_from_file_mt)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "io.h"
+#include "graph.h"
+#include "utils.h"
+
+#define TEST_FILE "out/io_parallel_test.txt"
+#define DIAG_FILE "out/io_parallel_diag.txt"
+
+/**
+ * @brief  Génère un gros fichier de graphe avec commentaires et lignes invalides
+ *
+ * Environ 1 Mo : assez pour que le découpage en morceaux soit réellement
+ * utilisé avec plusieurs threads (au moins 64 Kio par morceau).
+ */
+static void write_test_file(const char *path, int n, int lines) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror("fopen(test file)");
+        exit(EXIT_FAILURE);
+    }
+    fprintf(f, "# graphe synthétique pour la lecture parallèle\n\n%d\n", n);
+    unsigned seed = 12345u;
+    for (int i = 0; i < lines; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int from = (int)((seed >> 8) % (unsigned)n) + 1;
+        seed = seed * 1103515245u + 12345u;
+        int to = (int)((seed >> 8) % (unsigned)n) + 1;
+        float p = (float)((seed >> 4) % 1000u) / 1000.0f;
+        switch (i % 97) {
+            case 13: fprintf(f, "// commentaire %d\n", i);        break;
+            case 29: fputs("\n", f);                              break;
+            case 41: fprintf(f, "%d %d\n", from, to);             break; // format invalide
+            case 53: fprintf(f, "%d %d %.3f\n", n + 1, to, p);    break; // sommet hors bornes
+            case 67: fprintf(f, "%d %d 1.5\n", from, to);         break; // proba invalide
+            default: fprintf(f, "%d %d %.3f\n", from, to, p);     break;
+        }
+    }
+    fclose(f);
+}
+
+// Lit le fichier avec 'threads' threads en capturant stderr dans DIAG_FILE
+static char *read_with_diag(const char *path, AdjList *g, int threads) {
+    fflush(stderr);
+    int saved = dup(2);
+    int fd = open(DIAG_FILE, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (saved < 0 || fd < 0) {
+        perror("dup/open");
+        exit(EXIT_FAILURE);
+    }
+    dup2(fd, 2);
+    close(fd);
+
+    read_graph_from_file_mt(path, g, threads);
+
+    fflush(stderr);
+    dup2(saved, 2);
+    close(saved);
+
+    // Relecture des diagnostics capturés
+    FILE *f = fopen(DIAG_FILE, "rb");
+    if (!f) {
+        perror("fopen(diag)");
+        exit(EXIT_FAILURE);
+    }
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *buf = (char *)calloc((size_t)len + 1, 1);
+    if (!buf || fread(buf, 1, (size_t)len, f) != (size_t)len) {
+        perror("fread(diag)");
+        exit(EXIT_FAILURE);
+    }
+    fclose(f);
+    return buf;
+}
+
+// Compare deux graphes arête par arête (ordre des listes compris)
+static int same_graph(const AdjList *a, const AdjList *b) {
+    if (a->size != b->size) return 0;
+    for (int i = 0; i < a->size; ++i) {
+        if (a->offsets[i + 1] - a->offsets[i] != b->offsets[i + 1] - b->offsets[i]) return 0;
+        for (int64_t k = a->offsets[i], l = b->offsets[i]; k < a->offsets[i + 1]; ++k, ++l) {
+            if (a->dests[k] != b->dests[l] || a->probas[k] != b->probas[l]) return 0;
+        }
+    }
+    return 1;
+}
+
+int main(void) {
+    printf("=== TEST Partie 1.2 bis : io_parallel (lecture multi-thread) ===\n");
+
+    if (ensure_dir("out") != 0) {
+        perror("ensure_dir(out)");
+        return 1;
+    }
+    write_test_file(TEST_FILE, 500, 60000);
+
+    AdjList ref;
+    char *ref_diag = read_with_diag(TEST_FILE, &ref, 1);
+    printf("  - référence séquentielle : %d sommets, %zu octets de diagnostics\n",
+           ref.size, strlen(ref_diag));
+
+    int failures = 0;
+    const int counts[] = {2, 3, 4, 7, 16};
+    for (size_t k = 0; k < sizeof(counts) / sizeof(counts[0]); ++k) {
+        AdjList g;
+        char *diag = read_with_diag(TEST_FILE, &g, counts[k]);
+        int ok_graph = same_graph(&ref, &g);
+        int ok_diag = strcmp(ref_diag, diag) == 0;
+        printf("  [%s] threads=%d graphe %s, diagnostics %s\n",
+               (ok_graph && ok_diag) ? "OK" : "FAIL", counts[k],
+               ok_graph ? "identique" : "DIFFÉRENT", ok_diag ? "identiques" : "DIFFÉRENTS");
+        if (!ok_graph || !ok_diag) failures++;
+        free(diag);
+        graph_free(&g);
+    }
+
+    free(ref_diag);
+    graph_free(&ref);
+    remove(TEST_FILE);
+    remove(DIAG_FILE);
+
+    if (failures > 0) {
+        printf("\n=> %d test(s) échoué(s).\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("=== FIN TEST io_parallel ===\n");
+    return 0;
+}
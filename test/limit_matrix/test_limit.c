@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph.h"
+#include "scc.h"
+#include "tarjan.h"
+#include "hasse.h"
+#include "markov_props.h"
+#include "matrix.h"
+#include "limit.h"
+
+static void check_int_equal(const char *label, int got, int expected, int *failures)
+{
+    if (got == expected) {
+        printf("  [OK]   %s (attendu=%d, obtenu=%d)\n", label, expected, got);
+    } else {
+        printf("  [FAIL] %s (attendu=%d, obtenu=%d)\n", label, expected, got);
+        (*failures)++;
+    }
+}
+
+static void check_below(const char *label, double got, double bound, int *failures)
+{
+    if (got >= 0.0 && got <= bound) {
+        printf("  [OK]   %s (%.2e <= %.0e)\n", label, got, bound);
+    } else {
+        printf("  [FAIL] %s (%.2e > %.0e)\n", label, got, bound);
+        (*failures)++;
+    }
+}
+
+/**
+ * @brief  Partition, types de classes puis matrice limite par classes
+ *
+ * @return  Code de retour de limit_build
+ */
+static int build_limit(const AdjList *g, t_limit *L)
+{
+    Partition P;
+    scc_init_partition(&P);
+    tarjan_partition(g, &P);
+    HasseLinkArray links;
+    hasse_init_links(&links);
+    build_class_links(g, &P, &links);
+    int *is_transient = malloc((size_t)P.count * sizeof(int));
+    int *is_persistent = malloc((size_t)P.count * sizeof(int));
+    markov_class_types(&links, P.count, is_transient, is_persistent);
+
+    t_spmatrix S = spmx_from_adjlist(g);
+    int rc = limit_build(g, &P, is_persistent, &S, STAT_AUTO, LIMIT_EPS, 10000, 0.8, L);
+
+    spmx_free(&S);
+    free(is_transient);
+    free(is_persistent);
+    hasse_free_links(&links);
+    scc_free_partition(&P);
+    return rc;
+}
+
+/**
+ * @brief  Moyenne de Cesàro (1/K) somme_{k<K} P^k par produits denses
+ *
+ * Référence indépendante du calcul par classes, valable même quand M^n
+ * ne converge pas (classes périodiques). Erreur en O(1/K).
+ */
+static t_matrix cesaro_average(const AdjList *g, int K)
+{
+    t_matrix M = mx_from_adjlist(g);
+    int n = M.n;
+    t_matrix Pk = mx_zeros(n);
+    t_matrix Next = mx_zeros(n);
+    t_matrix Avg = mx_zeros(n);
+    for (int i = 0; i < n; ++i) Pk.a[i][i] = 1.0f;
+
+    double *acc = calloc((size_t)n * n, sizeof(double));
+    for (int k = 0; k < K; ++k) {
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) acc[(size_t)i * n + j] += Pk.a[i][j];
+        }
+        mx_mul(&Pk, &M, &Next);
+        t_matrix tmp = Pk;
+        Pk = Next;
+        Next = tmp;
+    }
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) Avg.a[i][j] = (float)(acc[(size_t)i * n + j] / K);
+    }
+    free(acc);
+    mx_free(&M);
+    mx_free(&Pk);
+    mx_free(&Next);
+    return Avg;
+}
+
+static void test_periodic_with_transients(int *failures)
+{
+    printf("\n--- TEST 1 : classe de période 2, absorbant, transitoires en chaîne ---\n");
+
+    // {1,2} période 2 ; {3} absorbant ; 4 -> {1,2} ou 3 ; {5,6} -> 4 ou 1
+    AdjList g;
+    graph_init(&g, 6);
+    graph_add_edge(&g, 1, 2, 1.0f);
+    graph_add_edge(&g, 2, 1, 1.0f);
+    graph_add_edge(&g, 3, 3, 1.0f);
+    graph_add_edge(&g, 4, 2, 0.25f);
+    graph_add_edge(&g, 4, 3, 0.75f);
+    graph_add_edge(&g, 5, 6, 0.5f);
+    graph_add_edge(&g, 5, 4, 0.5f);
+    graph_add_edge(&g, 6, 5, 0.5f);
+    graph_add_edge(&g, 6, 1, 0.5f);
+
+    t_limit L;
+    int rc = build_limit(&g, &L);
+    check_int_equal("Convergence", rc, 1, failures);
+
+    // M^n oscille : l'ancienne recherche dense échoue
+    t_matrix M = mx_from_adjlist(&g);
+    t_matrix Mc = mx_zeros(M.n);
+    int steps = 0;
+    check_int_equal("mx_power_until_diff (périodique)", mx_power_until_diff(&M, 1e-4f, 200, &Mc, &steps), 0,
+                    failures);
+
+    t_matrix ref = cesaro_average(&g, 4000);
+    check_below("Ecart à la moyenne de Cesàro", limit_max_diff(&L, &ref), 2e-3, failures);
+
+    // Valeurs exactes : 4 finit dans {1,2} avec 1/4, chaque état pesant 1/2
+    t_matrix D = mx_zeros(0);
+    limit_to_dense(&L, &D);
+    check_below("Pi[4][1] = 1/8", D.a[3][0] > 0.125f ? D.a[3][0] - 0.125f : 0.125f - D.a[3][0], 1e-6, failures);
+    check_below("Pi[4][3] = 3/4", D.a[3][2] > 0.75f ? D.a[3][2] - 0.75f : 0.75f - D.a[3][2], 1e-6, failures);
+    check_below("Pi[1][4] = 0 (colonne transitoire)", D.a[0][3], 0.0, failures);
+
+    mx_free(&D);
+    mx_free(&ref);
+    mx_free(&Mc);
+    mx_free(&M);
+    limit_free(&L);
+    graph_free(&g);
+}
+
+static void test_aperiodic_vs_dense_power(int *failures)
+{
+    printf("\n--- TEST 2 : chaîne apériodique, validation par mx_power_until_diff ---\n");
+
+    AdjList g;
+    graph_init(&g, 5);
+    graph_add_edge(&g, 1, 1, 0.5f);
+    graph_add_edge(&g, 1, 2, 0.5f);
+    graph_add_edge(&g, 2, 1, 0.3f);
+    graph_add_edge(&g, 2, 3, 0.7f);
+    graph_add_edge(&g, 3, 1, 1.0f);
+    graph_add_edge(&g, 4, 4, 1.0f);
+    graph_add_edge(&g, 5, 3, 0.4f);
+    graph_add_edge(&g, 5, 4, 0.4f);
+    graph_add_edge(&g, 5, 5, 0.2f);
+
+    t_limit L;
+    int rc = build_limit(&g, &L);
+    check_int_equal("Convergence", rc, 1, failures);
+
+    t_matrix M = mx_from_adjlist(&g);
+    t_matrix Mc = mx_zeros(M.n);
+    int steps = 0;
+    int conv = mx_power_until_diff(&M, 1e-7f, 2000, &Mc, &steps);
+    check_int_equal("mx_power_until_diff (apériodique)", conv, 1, failures);
+    check_below("Ecart |M^n - limite|", limit_max_diff(&L, &Mc), 1e-5, failures);
+
+    mx_free(&Mc);
+    mx_free(&M);
+    limit_free(&L);
+    graph_free(&g);
+}
+
+int main(void)
+{
+    printf("=== TEST Partie 3 : matrice limite par classes (--limit) ===\n");
+
+    int failures = 0;
+
+    test_periodic_with_transients(&failures);
+    test_aperiodic_vs_dense_power(&failures);
+
+    if (failures > 0) {
+        printf("\n=> ❌ %d test(s) échoué(s).\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("\n=> ✅ Tous les tests de matrice limite ont réussi.\n");
+    return EXIT_SUCCESS;
+}
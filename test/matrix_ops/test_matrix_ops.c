@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
 
 #include "graph.h"
 #include "matrix.h"
@@ -72,19 +74,19 @@ static void print_distribution(const char *label, const float *pi, int n)
 }
 
 /**
- * @brief  Calcule la puissance entière d'une matrice: out = M^k
+ * @brief  Puissance de référence par multiplications successives: out = M^k
  *
  * Pour k >= 1, effectue k-1 multiplications successives en utilisant `mx_mul`.
- * La matrice résultat est copiée dans `out`.
+ * Sert à valider `mx_power_int` (exponentiation binaire).
  *
  * @param[in]  M    Matrice de base (carrée)
  * @param[in]  k    Puissance entière (k >= 1)
  * @param[out] out  Matrice résultat
  */
-static void mx_power_int(const t_matrix *M, int k, t_matrix *out)
+static void power_sequential(const t_matrix *M, int k, t_matrix *out)
 {
     if (!M || M->n <= 0 || !M->a || k < 1) {
-        fprintf(stderr, "[test_matrix_ops][ERR] Paramètres invalides pour mx_power_int\n");
+        fprintf(stderr, "[test_matrix_ops][ERR] Paramètres invalides pour power_sequential\n");
         exit(EXIT_FAILURE);
     }
 
@@ -104,6 +106,59 @@ static void mx_power_int(const t_matrix *M, int k, t_matrix *out)
     mx_free(&tmp);
 }
 
+/**
+ * @brief  Compare mx_power_int (exponentiation binaire) aux produits successifs
+ *
+ * Identité bit à bit pour k <= 3 (mêmes produits), écart L1 faible au-delà.
+ * Une très grande puissance doit rester finie et proche d'une matrice
+ * stochastique : les sommes de lignes en float de M ne valent pas exactement
+ * 1, d'où une dérive de quelques % après un million de transitions.
+ *
+ * @param[in] M  Matrice de transition de base
+ *
+ * @return  Nombre d'écarts constatés
+ */
+static int check_power_engine(const t_matrix *M)
+{
+    int failures = 0;
+    t_matrix fast = mx_zeros(M->n);
+    t_matrix slow = mx_zeros(M->n);
+
+    for (int k = 1; k <= 40; ++k) {
+        mx_power_int(M, k, &fast);
+        power_sequential(M, k, &slow);
+        float diff = mx_diff_abs1(&fast, &slow);
+        int ok = (k <= 3) ? (diff == 0.0f) : (diff < 1e-5f);
+        if (!ok) {
+            printf("  [FAIL] mx_power_int k=%d : écart %.3g avec les produits successifs\n", k, (double)diff);
+            failures++;
+        }
+    }
+
+    mx_power_int(M, 0, &fast);
+    for (int i = 0; i < M->n; ++i) {
+        for (int j = 0; j < M->n; ++j) {
+            if (fast.a[i][j] != (i == j ? 1.0f : 0.0f)) failures++;
+        }
+    }
+
+    mx_power_int(M, 1000000, &fast);
+    for (int i = 0; i < M->n; ++i) {
+        float s = 0.0f;
+        for (int j = 0; j < M->n; ++j) s += fast.a[i][j];
+        if (!(s > 0.95f && s < 1.05f)) {
+            printf("  [FAIL] M^1000000 : somme de la ligne %d = %.4f\n", i + 1, (double)s);
+            failures++;
+        }
+    }
+    print_distribution("  M^1000000, ligne 1 :", fast.a[0], M->n);
+
+    printf("  [%s] mx_power_int (k = 0..40 et k = 1000000)\n", failures ? "FAIL" : "OK");
+    mx_free(&fast);
+    mx_free(&slow);
+    return failures;
+}
+
 /**
  * @brief  Test simple de convergence: diff(M^k, M^{k+1}) < eps
  *
@@ -139,6 +194,236 @@ static void test_convergence(const t_matrix *M, int max_iter, float eps)
     mx_free(&Mk1);
 }
 
+/**
+ * @brief  Vérifie que les noyaux creux donnent exactement les résultats denses
+ *
+ * Compare `dist_power_sp` à `dist_power` (t = 1..10, départ de chaque état)
+ * et `stationary_distribution_sp` à `stationary_distribution`, bit à bit.
+ *
+ * @param[in] g  Graphe de test
+ * @param[in] M  Matrice dense correspondante
+ *
+ * @return  Nombre d'écarts constatés
+ */
+static int check_sparse_matches_dense(const AdjList *g, const t_matrix *M)
+{
+    t_spmatrix S = spmx_from_adjlist(g);
+    int n = M->n;
+    int failures = 0;
+
+    float *pi0 = (float *)calloc((size_t)n, sizeof(float));
+    float *dense = (float *)calloc((size_t)n, sizeof(float));
+    float *sparse = (float *)calloc((size_t)n, sizeof(float));
+    if (!pi0 || !dense || !sparse) {
+        fprintf(stderr, "[test_matrix_ops][ERR] calloc pour la comparaison creux/dense\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int start = 0; start < n; ++start) {
+        memset(pi0, 0, (size_t)n * sizeof(float));
+        pi0[start] = 1.0f;
+        for (int t = 1; t <= 10; ++t) {
+            dist_power(pi0, M, t, dense);
+            dist_power_sp(pi0, &S, t, sparse);
+            if (memcmp(dense, sparse, (size_t)n * sizeof(float)) != 0) {
+                printf("  [FAIL] dist_power_sp != dist_power (départ %d, t=%d)\n", start + 1, t);
+                failures++;
+            }
+        }
+    }
+
+    int conv_dense = stationary_distribution(M, 1e-6f, 200, dense);
+    int conv_sparse = stationary_distribution_sp(&S, 1e-6f, 200, sparse);
+    if (conv_dense != conv_sparse || memcmp(dense, sparse, (size_t)n * sizeof(float)) != 0) {
+        printf("  [FAIL] stationary_distribution_sp != stationary_distribution\n");
+        failures++;
+    }
+
+    printf("  [%s] noyaux creux identiques aux noyaux denses (nnz=%lld)\n",
+           failures ? "FAIL" : "OK", (long long)S.nnz);
+
+    free(pi0);
+    free(dense);
+    free(sparse);
+    spmx_free(&S);
+    return failures;
+}
+
+/**
+ * @brief  Vérifie que la propagation par blocs reproduit dist_power_sp
+ *
+ * Bloc de b = n + 2 distributions (chaque état, uniforme, distribution
+ * nulle), comparé colonne par colonne à dist_power_sp pour t = 0..10.
+ *
+ * @param[in] g  Graphe de test
+ *
+ * @return  Nombre d'écarts constatés
+ */
+static int check_block_matches_single(const AdjList *g)
+{
+    t_spmatrix S = spmx_from_adjlist(g);
+    int n = S.n;
+    int b = n + 2;
+    int failures = 0;
+
+    float *P0 = (float *)calloc((size_t)n * (size_t)b, sizeof(float));
+    float *Pt = (float *)calloc((size_t)n * (size_t)b, sizeof(float));
+    float *pi0 = (float *)calloc((size_t)n, sizeof(float));
+    float *pit = (float *)calloc((size_t)n, sizeof(float));
+    if (!P0 || !Pt || !pi0 || !pit) {
+        fprintf(stderr, "[test_matrix_ops][ERR] calloc pour la propagation par blocs\n");
+        exit(EXIT_FAILURE);
+    }
+    // colonne i < n : départ de l'état i ; colonne n : uniforme ; colonne n+1 : nulle
+    for (int i = 0; i < n; ++i) {
+        P0[(size_t)i * b + i] = 1.0f;
+        P0[(size_t)i * b + n] = 1.0f / (float)n;
+    }
+
+    for (int t = 0; t <= 10; ++t) {
+        dist_power_sp_block(P0, &S, b, t, Pt);
+        for (int s = 0; s < b; ++s) {
+            for (int i = 0; i < n; ++i) pi0[i] = P0[(size_t)i * b + s];
+            dist_power_sp(pi0, &S, t, pit);
+            for (int i = 0; i < n; ++i) {
+                if (memcmp(&pit[i], &Pt[(size_t)i * b + s], sizeof(float)) != 0) {
+                    printf("  [FAIL] dist_power_sp_block != dist_power_sp (colonne %d, t=%d)\n", s, t);
+                    failures++;
+                    break;
+                }
+            }
+        }
+    }
+    printf("  [%s] propagation de %d distributions par bloc identique à dist_power_sp\n",
+           failures ? "FAIL" : "OK", b);
+
+    free(P0);
+    free(Pt);
+    free(pi0);
+    free(pit);
+    spmx_free(&S);
+    return failures;
+}
+
+/**
+ * @brief  Vérifie que mx_mul donne le même résultat quel que soit le nombre de threads
+ *
+ * @return  Nombre d'écarts constatés
+ */
+static int check_threads_match_sequential(void)
+{
+    const int n = 301; // assez grand pour le découpage, non multiple de 4
+    t_matrix A = mx_zeros(n);
+    t_matrix B = mx_zeros(n);
+    t_matrix ref = mx_zeros(n);
+    t_matrix C = mx_zeros(n);
+    unsigned seed = 7u;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            seed = seed * 1103515245u + 12345u;
+            A.a[i][j] = (float)((seed >> 8) % 1000u) / 1000.0f;
+            seed = seed * 1103515245u + 12345u;
+            B.a[i][j] = (float)((seed >> 8) % 1000u) / 1000.0f;
+        }
+    }
+
+    int failures = 0;
+    mx_set_threads(1);
+    mx_mul(&A, &B, &ref);
+    const int counts[] = {2, 3, 8, 64};
+    for (size_t k = 0; k < sizeof(counts) / sizeof(counts[0]); ++k) {
+        mx_set_threads(counts[k]);
+        mx_mul(&A, &B, &C);
+        int same = memcmp(ref.a[0], C.a[0], (size_t)n * (size_t)n * sizeof(float)) == 0;
+        printf("  [%s] mx_mul avec %d threads identique au calcul séquentiel\n", same ? "OK" : "FAIL", counts[k]);
+        if (!same) failures++;
+    }
+    mx_set_threads(1);
+
+    mx_free(&A);
+    mx_free(&B);
+    mx_free(&ref);
+    mx_free(&C);
+    return failures;
+}
+
+/**
+ * @brief  Compare mx_power_until_diff_squaring à la recherche linéaire
+ *
+ * Cas : la météo, une marche paresseuse sur un anneau (mélange en milliers
+ * d'étapes), une chaîne de période 2 (jamais convergée) et max_iter = 1.
+ * Sur l'anneau, d(n) ne baisse que de 0,1 % par étape : les 3000 produits
+ * de la recherche linéaire dérivent assez pour décaler n d'une unité. La
+ * valeur exacte (3359, par les valeurs propres 0,9 + 0,1·cos(2πm/40) de
+ * la matrice circulante) est attendue de la recherche par carrés, la
+ * recherche linéaire doit être à au plus une unité.
+ *
+ * @param[in] M  Matrice de transition météo
+ *
+ * @return  Nombre d'écarts constatés
+ */
+static int check_squaring_matches_linear(const t_matrix *M)
+{
+    const int ring = 40;
+    t_matrix R = mx_zeros(ring);
+    for (int i = 0; i < ring; ++i) {
+        R.a[i][i] = 0.9f;
+        R.a[i][(i + 1) % ring] = 0.05f;
+        R.a[i][(i + ring - 1) % ring] = 0.05f;
+    }
+    t_matrix C = mx_zeros(2);
+    C.a[0][1] = 1.0f;
+    C.a[1][0] = 1.0f;
+
+    struct {
+        const char *label;
+        const t_matrix *M;
+        float eps;
+        int max_iter;
+        int expected_n;
+    } cases[] = {
+        {"météo, eps=1e-3", M, 1e-3f, 20, 8},
+        {"météo, max_iter=1", M, 1e-3f, 1, 2},
+        {"anneau paresseux de 40 états, eps=1e-3", &R, 1e-3f, 20000, 3359},
+        {"anneau, max_iter=100 (non atteint)", &R, 1e-3f, 100, 101},
+        {"période 2 (non atteint)", &C, 1e-3f, 37, 38},
+        {"météo, max_iter=INT_MAX", M, 1e-3f, INT_MAX, 8},
+    };
+
+    int failures = 0;
+    for (size_t k = 0; k < sizeof(cases) / sizeof(cases[0]); ++k) {
+        t_matrix lin = mx_zeros(0);
+        t_matrix sq = mx_zeros(0);
+        int n_lin = 0, n_sq = 0;
+        int rc_lin = mx_power_until_diff(cases[k].M, cases[k].eps, cases[k].max_iter, &lin, &n_lin);
+        int rc_sq = mx_power_until_diff_squaring(cases[k].M, cases[k].eps, cases[k].max_iter, &sq, &n_sq);
+        // Un décalage d'une unité écarte les deux résultats d'environ eps
+        float diff = mx_diff_abs1(&lin, &sq);
+        int ok = rc_lin == rc_sq && n_sq == cases[k].expected_n && n_lin - n_sq <= 1 && n_sq - n_lin <= 1
+                 && diff < 5.0f * cases[k].eps;
+        printf("  [%s] %s : rc %d/%d, n %d/%d (attendu %d), écart L1 %.2e\n", ok ? "OK" : "FAIL", cases[k].label,
+               rc_lin, rc_sq, n_lin, n_sq, cases[k].expected_n, (double)diff);
+        if (!ok) failures++;
+        mx_free(&lin);
+        mx_free(&sq);
+    }
+
+    // max_iter = INT_MAX : ramené à MX_POWER_MAX_ITER, n = max_iter + 1 sans
+    // débordement (carrés seulement : la recherche linéaire ferait 2^30 produits)
+    t_matrix big = mx_zeros(0);
+    int n_big = 0;
+    int rc_big = mx_power_until_diff_squaring(&C, 1e-3f, INT_MAX, &big, &n_big);
+    int ok_big = rc_big == 0 && n_big == MX_POWER_MAX_ITER + 1;
+    printf("  [%s] période 2, max_iter=INT_MAX : rc %d, n %d (attendu %d)\n", ok_big ? "OK" : "FAIL",
+           rc_big, n_big, MX_POWER_MAX_ITER + 1);
+    if (!ok_big) failures++;
+    mx_free(&big);
+
+    mx_free(&R);
+    mx_free(&C);
+    return failures;
+}
+
 /**
  * @brief  Programme de test pour la Partie 3.1 (matrix-ops)
  *
@@ -147,6 +432,11 @@ static void test_convergence(const t_matrix *M, int max_iter, float eps)
  * - affiche M, M^3 et M^7
  * - calcule des distributions \Pi_t pour Cloudy et Rainy
  * - effectue un test de convergence \|M^k - M^{k+1}\|_1 < eps
+ * - vérifie les variantes creuses (t_spmatrix) contre les versions denses
+ * - vérifie la propagation par blocs (dist_power_sp_block) contre dist_power_sp
+ * - vérifie mx_power_int (exponentiation binaire) contre les produits successifs
+ * - vérifie la recherche de convergence par carrés contre la recherche linéaire
+ * - vérifie que mx_mul multi-thread reproduit le calcul séquentiel
  */
 int main(void)
 {
@@ -214,6 +504,23 @@ int main(void)
     printf("\n[Test] Convergence des puissances M^k :\n");
     test_convergence(&M, 20, 1e-3f);
 
+    /* Variantes creuses (t_spmatrix) */
+    printf("\n[Test] Matrice creuse et distributions :\n");
+    int failures = check_sparse_matches_dense(&g, &M);
+    failures += check_block_matches_single(&g);
+
+    /* Puissances par exponentiation binaire */
+    printf("\n[Test] Moteur de puissance mx_power_int :\n");
+    failures += check_power_engine(&M);
+
+    /* Recherche de convergence par carrés successifs */
+    printf("\n[Test] Convergence par carrés et dichotomie :\n");
+    failures += check_squaring_matches_linear(&M);
+
+    /* Produit dense multi-thread */
+    printf("\n[Test] mx_mul multi-thread :\n");
+    failures += check_threads_match_sequential();
+
     free(pi0);
     free(pit);
 
@@ -222,6 +529,10 @@ int main(void)
     mx_free(&M7);
     graph_free(&g);
 
+    if (failures > 0) {
+        printf("\n=> %d test(s) échoué(s).\n", failures);
+        return EXIT_FAILURE;
+    }
     printf("\n=== FIN TEST matrix-ops ===\n");
     return 0;
 }
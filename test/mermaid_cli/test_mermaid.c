@@ -6,8 +6,7 @@
 #include <sys/stat.h>
 
 /* ====== Headers du projet ====== */
-#include "graph.h"     // AdjList, List, ...
-#include "list.h"      // Cell (si défini ici chez toi)
+#include "graph.h"     // AdjList (CSR)
 #include "utils.h"     // get_id_alpha, near_one, ensure_dir
 #include "mermaid.h"   // export_mermaid
 
@@ -20,8 +19,8 @@ static void print_adjlist(const AdjList *g, const char *title) {
     if (title) printf("=== %s ===\n", title);
     for (int i = 1; i <= g->size; ++i) {
         printf("[%s](%d):", get_id_alpha(i), i);
-        for (Cell *c = g->array[i - 1].head; c; c = c->next) {
-            printf(" -> (%d, %.2f)", c->dest, (double)c->proba);
+        for (int64_t k = g->offsets[i - 1]; k < g->offsets[i]; ++k) {
+            printf(" -> (%d, %.2f)", g->dests[k], (double)g->probas[k]);
         }
         puts("");
     }
@@ -36,8 +35,8 @@ int verify_markov(const AdjList *g, float eps) {
     int ok = 1;
     for (int i = 1; i <= g->size; ++i) {
         float s = 0.0f;
-        for (Cell *c = g->array[i - 1].head; c; c = c->next) {
-            s += c->proba;
+        for (int64_t k = g->offsets[i - 1]; k < g->offsets[i]; ++k) {
+            s += g->probas[k];
         }
         if (!near_one(s, eps)) {
             fprintf(stderr, "[MARKOV] Sommet %d: somme=%.4f (eps=%.4f) -> NON valide\n",
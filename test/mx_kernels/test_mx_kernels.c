@@ -0,0 +1,196 @@
+// Tests unitaires des noyaux denses (identité bit à bit avec le noyau naïf)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mx_kernels.h"
+
+// Matrice n×n pseudo-aléatoire, valeurs de signes et d'ordres de grandeur variés
+static float *random_matrix(int n, unsigned seed) {
+    float *m = (float *)malloc((size_t)n * (size_t)n * sizeof(float));
+    if (!m) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < (size_t)n * (size_t)n; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        m[i] = ((float)((seed >> 8) % 20001u) - 10000.0f) / (float)(1u + (seed >> 28));
+    }
+    return m;
+}
+
+static double dabs(double v) { return v < 0.0 ? -v : v; }
+
+/**
+ * @brief  Compare mx_kernel_vecmat (chaque noyau) au noyau naïf pour une taille
+ *
+ * Le vecteur contient des composantes nulles (lignes sautées) et non nulles
+ * en nombre non multiple de 4 (regroupement des lignes). L'étape fusionnée
+ * mx_kernel_vecmat_l1 doit donner le même y, et le même résidu pour tous
+ * les noyaux, proche de ||y - x||_1 calculé en double.
+ *
+ * @return  Nombre d'écarts constatés
+ */
+static int check_vecmat(int n) {
+    float *A = random_matrix(n, 5u + (unsigned)n);
+    float *x = (float *)malloc((size_t)n * sizeof(float));
+    float *ref = (float *)malloc((size_t)n * sizeof(float));
+    float *y = (float *)malloc((size_t)n * sizeof(float));
+    if (!ref || !y || !x) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; ++i) {
+        x[i] = (i % 3 == 1) ? 0.0f : A[i] / 7.0f;
+    }
+
+    mx_kernel_select(MX_KERNEL_NAIVE);
+    mx_kernel_vecmat(x, A, ref, n);
+    float ref_res = mx_kernel_vecmat_l1(x, A, y, n);
+    double exact = 0.0;
+    for (int j = 0; j < n; ++j) exact += dabs((double)ref[j] - (double)x[j]);
+
+    int failures = 0;
+    if (memcmp(ref, y, (size_t)n * sizeof(float)) != 0 || dabs(ref_res - exact) > 1e-5 * exact) {
+        printf("  [FAIL] vecmat_l1 n=%d noyau=naive (résidu %.6g, attendu %.6g)\n", n, (double)ref_res, exact);
+        failures++;
+    }
+    for (int k = MX_KERNEL_PORTABLE; k < MX_KERNEL_COUNT; ++k) {
+        if (!mx_kernel_supported((t_mx_kernel)k)) continue;
+        mx_kernel_select((t_mx_kernel)k);
+        memset(y, 0xff, (size_t)n * sizeof(float));
+        mx_kernel_vecmat(x, A, y, n);
+        if (memcmp(ref, y, (size_t)n * sizeof(float)) != 0) {
+            printf("  [FAIL] vecmat n=%d noyau=%s\n", n, mx_kernel_name((t_mx_kernel)k));
+            failures++;
+        }
+        memset(y, 0xff, (size_t)n * sizeof(float));
+        float res = mx_kernel_vecmat_l1(x, A, y, n);
+        if (memcmp(ref, y, (size_t)n * sizeof(float)) != 0 || memcmp(&res, &ref_res, sizeof(float)) != 0) {
+            printf("  [FAIL] vecmat_l1 n=%d noyau=%s\n", n, mx_kernel_name((t_mx_kernel)k));
+            failures++;
+        }
+    }
+
+    free(A);
+    free(x);
+    free(ref);
+    free(y);
+    return failures;
+}
+
+/**
+ * @brief  Compare mx_kernel_diff_l1 et mx_kernel_diff_l1_clear entre noyaux
+ *
+ * Même valeur bit à bit pour tous les noyaux (voies fixes), proche de la
+ * somme en double ; la variante _clear doit remettre b à zéro.
+ *
+ * @return  Nombre d'écarts constatés
+ */
+static int check_diff_l1(int n) {
+    size_t len = (size_t)n * (size_t)n;
+    float *a = random_matrix(n, 3u + (unsigned)n);
+    float *b = random_matrix(n, 29u + (unsigned)n);
+    float *c = (float *)malloc(len * sizeof(float));
+    if (!c) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    double exact = 0.0;
+    for (size_t j = 0; j < len; ++j) exact += dabs((double)a[j] - (double)b[j]);
+
+    mx_kernel_select(MX_KERNEL_NAIVE);
+    float ref = mx_kernel_diff_l1(a, b, len);
+    int failures = 0;
+    if (dabs(ref - exact) > 1e-5 * exact) {
+        printf("  [FAIL] diff_l1 n=%d (%.6g, attendu %.6g)\n", n, (double)ref, exact);
+        failures++;
+    }
+    for (int k = MX_KERNEL_NAIVE; k < MX_KERNEL_COUNT; ++k) {
+        if (!mx_kernel_supported((t_mx_kernel)k)) continue;
+        mx_kernel_select((t_mx_kernel)k);
+        float d = mx_kernel_diff_l1(a, b, len);
+        memcpy(c, b, len * sizeof(float));
+        float dc = mx_kernel_diff_l1_clear(a, c, len);
+        int cleared = 1;
+        for (size_t j = 0; j < len; ++j) cleared &= (c[j] == 0.0f);
+        if (memcmp(&d, &ref, sizeof(float)) != 0 || memcmp(&dc, &ref, sizeof(float)) != 0 || !cleared) {
+            printf("  [FAIL] diff_l1 n=%d noyau=%s (remise à zéro %s)\n", n, mx_kernel_name((t_mx_kernel)k),
+                   cleared ? "ok" : "KO");
+            failures++;
+        }
+    }
+
+    free(a);
+    free(b);
+    free(c);
+    return failures;
+}
+
+int main(void) {
+    printf("=== TEST Partie 3.1 bis : mx_kernels (produits denses et normes L1) ===\n");
+
+    // Tailles choisies pour couvrir les bords des tuiles et des micro-noyaux
+    const int sizes[] = {1, 2, 3, 5, 17, 33, 64, 129, 200, 513};
+    int failures = 0;
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        int n = sizes[s];
+        size_t bytes = (size_t)n * (size_t)n * sizeof(float);
+        float *A = random_matrix(n, 11u + (unsigned)n);
+        float *B = random_matrix(n, 97u + (unsigned)n);
+        float *ref = (float *)malloc(bytes);
+        float *C = (float *)malloc(bytes);
+        if (!ref || !C) {
+            perror("malloc");
+            return 1;
+        }
+
+        mx_kernel_select(MX_KERNEL_NAIVE);
+        mx_kernel_mul(A, B, ref, n, 0, n);
+
+        for (int k = MX_KERNEL_PORTABLE; k < MX_KERNEL_COUNT; ++k) {
+            if (mx_kernel_supported((t_mx_kernel)k) == 0) continue;
+            mx_kernel_select((t_mx_kernel)k);
+
+            // Produit complet, puis par plages de lignes (découpage des threads)
+            memset(C, 0xff, bytes);
+            mx_kernel_mul(A, B, C, n, 0, n);
+            int ok_full = memcmp(ref, C, bytes) == 0;
+
+            memset(C, 0xff, bytes);
+            int mid = n / 3;
+            mx_kernel_mul(A, B, C, n, 0, mid);
+            mx_kernel_mul(A, B, C, n, mid, n);
+            int ok_rows = memcmp(ref, C, bytes) == 0;
+
+            if (!ok_full || !ok_rows) {
+                printf("  [FAIL] n=%d noyau=%s (complet %s, par lignes %s)\n", n,
+                       mx_kernel_name((t_mx_kernel)k), ok_full ? "ok" : "KO", ok_rows ? "ok" : "KO");
+                failures++;
+            }
+        }
+        failures += check_vecmat(n);
+        failures += check_diff_l1(n);
+        printf("  [%s] n=%d (matrice × matrice, vecteur × matrice, normes L1)\n", failures ? "FAIL" : "OK", n);
+
+        free(A);
+        free(B);
+        free(ref);
+        free(C);
+    }
+
+    printf("  - noyaux supportés :");
+    for (int k = MX_KERNEL_NAIVE; k < MX_KERNEL_COUNT; ++k) {
+        if (mx_kernel_supported((t_mx_kernel)k)) printf(" %s", mx_kernel_name((t_mx_kernel)k));
+    }
+    mx_kernel_select(MX_KERNEL_AUTO);
+    printf(" (auto : %s)\n", mx_kernel_name(mx_kernel_active()));
+
+    if (failures > 0) {
+        printf("\n=> %d test(s) échoué(s).\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("=== FIN TEST mx_kernels ===\n");
+    return 0;
+}
@@ -3,6 +3,8 @@
 #include <math.h> 
 
 #include "matrix.h"
+#include "graph.h"
+#include "scc.h"
 #include "period.h"
 
 /**
@@ -69,6 +71,81 @@ static void run_case(const char *title,
     mx_free(&M); // Libère la mémoire
 }
 
+/**
+ * @brief Vérifie class_periods sur un graphe creux à plusieurs classes.
+ *
+ * Classes (étiquettes données à la main) :
+ *  - C0 = {1,2,3} : cycle 1 -> 2 -> 3 -> 1, période 3, sortie 3 -> 4 ;
+ *  - C1 = {4,5,6,7} : cycles 4-5-4 et 4-5-6-7-4, période 2, sortie 5 -> 8 ;
+ *  - C2 = {8,9} : cycles 8-9-8 et 9-9, apériodique.
+ */
+static void run_sparse_case(int *fail_count)
+{
+    printf("\n--- Cas 4 : graphe creux, périodes et sous-classes cycliques ---\n");
+
+    AdjList g;
+    graph_init(&g, 9);
+    graph_add_edge(&g, 1, 2, 1.0f);
+    graph_add_edge(&g, 2, 3, 1.0f);
+    graph_add_edge(&g, 3, 1, 0.5f);
+    graph_add_edge(&g, 3, 4, 0.5f);
+    graph_add_edge(&g, 4, 5, 1.0f);
+    graph_add_edge(&g, 5, 4, 0.4f);
+    graph_add_edge(&g, 5, 6, 0.4f);
+    graph_add_edge(&g, 5, 8, 0.2f);
+    graph_add_edge(&g, 6, 7, 1.0f);
+    graph_add_edge(&g, 7, 4, 1.0f);
+    graph_add_edge(&g, 8, 9, 1.0f);
+    graph_add_edge(&g, 9, 8, 0.5f);
+    graph_add_edge(&g, 9, 9, 0.5f);
+
+    const int label[9] = { 0, 0, 0, 1, 1, 1, 1, 2, 2 };
+    Partition P;
+    scc_init_partition(&P);
+    scc_partition_from_labels(&P, label, 9, 3);
+
+    int period[3];
+    int cyc[10];
+    class_periods(&g, &P, period, cyc);
+
+    check_int_equal("Période C0 (cycle de 3)", period[0], 3, fail_count);
+    check_int_equal("Période C1 (cycles 2 et 4)", period[1], 2, fail_count);
+    check_int_equal("Période C2 (boucle)", period[2], 1, fail_count);
+
+    // Sous-classes : chaque arc interne va de r à r+1 mod d
+    int cyc_ok = 1;
+    for (int u = 1; u <= 9; u++) {
+        int k = P.class_of[u];
+        for (int64_t e = g.offsets[u - 1]; e < g.offsets[u]; e++) {
+            int w = g.dests[e];
+            if (P.class_of[w] == k && cyc[w] != (cyc[u] + 1) % period[k]) cyc_ok = 0;
+        }
+    }
+    check_int_equal("Arcs internes r -> r+1 mod d", cyc_ok, 1, fail_count);
+    check_int_equal("Sous-classes distinctes dans C0", cyc[1] != cyc[2] && cyc[2] != cyc[3] && cyc[1] != cyc[3], 1, fail_count);
+
+    // Même période que la version dense sur chaque sous-matrice
+    for (int k = 0; k < P.count; k++) {
+        SccClass c = scc_class(&P, k);
+        t_matrix M = mx_zeros(c.count);
+        for (int i = 0; i < c.count; i++) {
+            int u = c.verts[i];
+            for (int64_t e = g.offsets[u - 1]; e < g.offsets[u]; e++) {
+                for (int j = 0; j < c.count; j++) {
+                    if (c.verts[j] == g.dests[e]) M.a[i][j] = g.probas[e];
+                }
+            }
+        }
+        char label_k[64];
+        snprintf(label_k, sizeof(label_k), "Dense = creux pour C%d", k);
+        check_int_equal(label_k, class_period(&M), period[k], fail_count);
+        mx_free(&M);
+    }
+
+    scc_free_partition(&P);
+    graph_free(&g);
+}
+
 int main(void)
 {
     printf("=== TEST Partie 3.3 : period-analysis ===\n");
@@ -106,6 +183,8 @@ int main(void)
     // Période attendue = 2. Unique stationnaire attendu = 0.
     run_case("Cas 3 : Graphe fortement périodique (d=2)", data_d2, 2, 2, 0, &failures);
 
+    run_sparse_case(&failures);
+
     if (failures > 0) {
         printf("\n=> ❌ %d test(s) échoué(s).\n", failures);
         return EXIT_FAILURE;
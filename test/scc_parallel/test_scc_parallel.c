@@ -0,0 +1,124 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph.h"
+#include "scc.h"
+#include "tarjan.h"
+#include "scc_parallel.h"
+#include "graph_gen.h"
+
+// label[v] = plus petit sommet de la classe de v (forme canonique d'une partition)
+static int *canonical_labels(const Partition *P, int n) {
+    int *label = (int *)calloc((size_t)n + 1, sizeof(int));
+    if (!label) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int c = 0; c < P->count; ++c) {
+        int m = scc_class(P, c).verts[0];
+        for (int j = 1; j < scc_class(P, c).count; ++j) {
+            if (scc_class(P, c).verts[j] < m) m = scc_class(P, c).verts[j];
+        }
+        for (int j = 0; j < scc_class(P, c).count; ++j) {
+            label[scc_class(P, c).verts[j]] = m;
+        }
+    }
+    return label;
+}
+
+// Retourne 1 si les deux partitions sont identiques (classes et ordre compris)
+static int same_partition(const Partition *a, const Partition *b) {
+    if (a->count != b->count) return 0;
+    for (int i = 0; i < a->count; ++i) {
+        if (scc_class(a, i).count != scc_class(b, i).count) return 0;
+        if (memcmp(scc_class(a, i).verts, scc_class(b, i).verts,
+                   (size_t)scc_class(a, i).count * sizeof(int)) != 0) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief  Compare scc_partition_parallel à Tarjan pour 1, 2, 3 et 8 threads
+ *
+ * Les classes doivent être les mêmes (comparaison sur la forme canonique) et
+ * la partition parallèle identique quel que soit le nombre de threads.
+ *
+ * @return  Nombre d'écarts constatés
+ */
+static int check_graph(const char *name, const AdjList *g) {
+    Partition ref;
+    scc_init_partition(&ref);
+    tarjan_partition(g, &ref);
+    int *ref_label = canonical_labels(&ref, g->size);
+
+    const int counts[] = {1, 2, 3, 8};
+    Partition first;
+    scc_init_partition(&first);
+    int failures = 0;
+    for (size_t t = 0; t < sizeof(counts) / sizeof(counts[0]); ++t) {
+        Partition P;
+        scc_init_partition(&P);
+        scc_partition_parallel(g, &P, counts[t]);
+        int *label = canonical_labels(&P, g->size);
+        int ok = P.count == ref.count
+              && memcmp(label, ref_label, ((size_t)g->size + 1) * sizeof(int)) == 0;
+        if (t == 0) {
+            first = P;
+        } else {
+            ok = ok && same_partition(&first, &P);
+            scc_free_partition(&P);
+        }
+        if (!ok) {
+            printf("  [FAIL] %s : partition différente avec %d thread(s)\n", name, counts[t]);
+            failures++;
+        }
+        free(label);
+    }
+    if (!failures) {
+        printf("  [OK] %s : %d classe(s), identique à Tarjan (1, 2, 3, 8 threads)\n", name, ref.count);
+    }
+
+    scc_free_partition(&first);
+    scc_free_partition(&ref);
+    free(ref_label);
+    return failures;
+}
+
+int main(void) {
+    printf("=== TEST Partie 2.1 bis : scc_parallel (CFC multi-thread) ===\n");
+
+    int failures = 0;
+    AdjList g;
+
+    gen_random(&g, 1000, 1, 1u);
+    failures += check_graph("aléatoire n=1000 degré 1", &g);
+    graph_free(&g);
+
+    gen_random(&g, 50000, 2, 2u);
+    failures += check_graph("aléatoire n=50000 degré 2", &g);
+    graph_free(&g);
+
+    gen_random(&g, 50000, 4, 3u);
+    failures += check_graph("aléatoire n=50000 degré 4", &g);
+    graph_free(&g);
+
+    gen_rings(&g, 400, 50, 4u);
+    failures += check_graph("400 anneaux de 50 sommets", &g);
+    graph_free(&g);
+
+    gen_dag_chain(&g, 100000);
+    failures += check_graph("chaîne orientée n=100000", &g);
+    graph_free(&g);
+
+    gen_birth_death(&g, 200000);
+    failures += check_graph("chaîne naissance-mort n=200000", &g);
+    graph_free(&g);
+
+    if (failures > 0) {
+        printf("\n=> %d test(s) échoué(s).\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("=== FIN TEST scc_parallel ===\n");
+    return 0;
+}
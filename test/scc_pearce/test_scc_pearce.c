@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph.h"
+#include "scc.h"
+#include "tarjan.h"
+#include "scc_pearce.h"
+#include "graph_gen.h"
+
+static int cmp_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief  Compare scc_partition_pearce à tarjan_partition
+ *
+ * Les classes doivent sortir dans le même ordre, avec les mêmes sommets
+ * (comparés après tri : l'ordre interne d'une classe peut différer).
+ *
+ * @return  0 si identique, 1 sinon
+ */
+static int check_graph(const char *name, const AdjList *g) {
+    Partition ref, P;
+    scc_init_partition(&ref);
+    scc_init_partition(&P);
+    tarjan_partition(g, &ref);
+    scc_partition_pearce(g, &P);
+
+    int ok = P.count == ref.count;
+    for (int c = 0; ok && c < ref.count; ++c) {
+        SccClass a = scc_class(&ref, c), b = scc_class(&P, c);
+        if (a.count != b.count) { ok = 0; break; }
+        qsort(a.verts, (size_t)a.count, sizeof(int), cmp_int);
+        qsort(b.verts, (size_t)b.count, sizeof(int), cmp_int);
+        ok = memcmp(a.verts, b.verts, (size_t)a.count * sizeof(int)) == 0;
+    }
+    if (ok) {
+        printf("  [OK] %s : %d classe(s), identique à Tarjan\n", name, ref.count);
+    } else {
+        printf("  [FAIL] %s : partition différente de Tarjan (%d contre %d classes)\n",
+               name, P.count, ref.count);
+    }
+
+    scc_free_partition(&ref);
+    scc_free_partition(&P);
+    return ok ? 0 : 1;
+}
+
+int main(void) {
+    printf("=== TEST Partie 2.1 ter : scc_pearce (CFC à mémoire réduite) ===\n");
+
+    int failures = 0;
+    AdjList g;
+
+    gen_random(&g, 1, 1, 1u);
+    failures += check_graph("un sommet (boucle)", &g);
+    graph_free(&g);
+
+    gen_random(&g, 1000, 1, 1u);
+    failures += check_graph("aléatoire n=1000 degré 1", &g);
+    graph_free(&g);
+
+    gen_random(&g, 50000, 2, 2u);
+    failures += check_graph("aléatoire n=50000 degré 2", &g);
+    graph_free(&g);
+
+    gen_random(&g, 50000, 4, 3u);
+    failures += check_graph("aléatoire n=50000 degré 4", &g);
+    graph_free(&g);
+
+    gen_rings(&g, 400, 50, 4u);
+    failures += check_graph("400 anneaux de 50 sommets", &g);
+    graph_free(&g);
+
+    gen_dag_chain(&g, 100000);
+    failures += check_graph("chaîne orientée n=100000", &g);
+    graph_free(&g);
+
+    // Profondeur de parcours 2M : pile d'appels agrandie à la demande
+    gen_birth_death(&g, 2000000);
+    failures += check_graph("chaîne naissance-mort n=2000000", &g);
+    graph_free(&g);
+
+    if (failures > 0) {
+        printf("\n=> %d test(s) échoué(s).\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("=== FIN TEST scc_pearce ===\n");
+    return 0;
+}
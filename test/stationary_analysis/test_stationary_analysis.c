@@ -1,9 +1,11 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 
 #include "matrix.h"
 #include "scc.h"
 #include "graph.h"
+#include "stationary.h"
 
 static const float EPS = 1e-6f;
 
@@ -183,6 +185,206 @@ static void test_submatrix_empty_class(int *failures)
     scc_free_partition(&P);
 }
 
+static void test_sparse_submatrix(int *failures)
+{
+    printf("\n--- TEST 6 : sous-matrice creuse (spmx_sub) ---\n");
+
+    AdjList g;
+    graph_init(&g, 4);
+    graph_add_edge(&g, 1, 1, 0.5f);
+    graph_add_edge(&g, 1, 2, 0.5f);
+    graph_add_edge(&g, 2, 1, 0.2f);
+    graph_add_edge(&g, 2, 2, 0.3f);
+    graph_add_edge(&g, 2, 3, 0.5f);
+    graph_add_edge(&g, 3, 3, 0.6f);
+    graph_add_edge(&g, 3, 4, 0.4f);
+    graph_add_edge(&g, 4, 3, 0.2f);
+    graph_add_edge(&g, 4, 4, 0.8f);
+
+    t_spmatrix S = spmx_from_adjlist(&g);
+    t_matrix M = mx_from_adjlist(&g);
+
+    Partition P;
+    scc_init_partition(&P);
+    SccClass C1 = scc_make_empty_class();
+    scc_add_vertex(&C1, 2);
+    scc_add_vertex(&C1, 1);
+    SccClass C2 = scc_make_empty_class();
+    scc_add_vertex(&C2, 4);
+    scc_add_vertex(&C2, 3);
+    scc_add_class(&P, C1);
+    scc_add_class(&P, C2);
+
+    // Chaque sous-matrice creuse doit coïncider avec la sous-matrice dense
+    for (int k = 0; k < P.count; ++k) {
+        t_spmatrix sub = spmx_sub(&S, P, k);
+        t_matrix dense = spmx_to_dense(&sub);
+        t_matrix ref = subMatrix(M, P, k);
+        check_int_equal("Taille sous-matrice creuse", sub.n, ref.n, failures);
+        for (int i = 0; i < ref.n; ++i) {
+            for (int j = 0; j < ref.n; ++j) {
+                check_float_equal("Coefficient", dense.a[i][j], ref.a[i][j], failures);
+            }
+        }
+        mx_free(&ref);
+        mx_free(&dense);
+        spmx_free(&sub);
+    }
+
+    t_spmatrix bad = spmx_sub(&S, P, 2);
+    check_int_equal("Taille (indice invalide)", bad.n, 0, failures);
+
+    scc_free_partition(&P);
+    mx_free(&M);
+    spmx_free(&S);
+    graph_free(&g);
+}
+
+// Matrice creuse depuis un tableau dense n×n (coefficients non nuls seulement)
+static t_spmatrix sparse_from_dense(int n, const float *data)
+{
+    AdjList g;
+    graph_init(&g, n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            if (data[i * n + j] != 0.0f) graph_add_edge(&g, i + 1, j + 1, data[i * n + j]);
+        }
+    }
+    t_spmatrix S = spmx_from_adjlist(&g);
+    graph_free(&g);
+    return S;
+}
+
+// Chaîne aléatoire irréductible : cycle 0 -> 1 -> ... -> 0 plus deg arcs par état
+static t_spmatrix random_chain(int n, int deg, unsigned seed)
+{
+    AdjList g;
+    graph_init(&g, n);
+    for (int i = 0; i < n; ++i) {
+        float w[16];
+        int to[16];
+        float sum = 0.0f;
+        to[0] = (i + 1) % n;
+        w[0] = 1.0f;
+        sum += w[0];
+        int m = 1;
+        for (int d = 1; d <= deg; ++d) {
+            seed = seed * 1103515245u + 12345u;
+            int t = (int)((seed >> 8) % (unsigned)n);
+            seed = seed * 1103515245u + 12345u;
+            int dup = 0;
+            for (int e = 0; e < m; ++e) dup |= (to[e] == t);
+            if (dup) continue; // un arc en double serait écrasé par spmx_from_adjlist
+            to[m] = t;
+            w[m] = 0.1f + (float)((seed >> 8) % 100u) / 50.0f;
+            sum += w[m];
+            m++;
+        }
+        for (int d = 0; d < m; ++d) graph_add_edge(&g, i + 1, to[d] + 1, w[d] / sum);
+    }
+    t_spmatrix S = spmx_from_adjlist(&g);
+    graph_free(&g);
+    return S;
+}
+
+/**
+ * @brief Compare chaque solveur à une distribution de référence.
+ *
+ * @param power_fails  1 si l'itération de la puissance ne doit pas converger
+ *                     en 5000 étapes (classe périodique ou presque décomposable)
+ */
+static void check_solvers(const char *title, const t_spmatrix *S, const float *ref,
+                          float tol, int power_fails, int *failures)
+{
+    const t_stat_solver solvers[] = {STAT_POWER, STAT_GTH, STAT_GS, STAT_SOR, STAT_BICGSTAB, STAT_AUTO};
+    float *pi = (float *)malloc((size_t)S->n * sizeof(float));
+
+    printf("\n--- %s (n=%d) ---\n", title, S->n);
+    for (int k = 0; k < (int)(sizeof(solvers) / sizeof(solvers[0])); ++k) {
+        t_solve_info info;
+        int conv = stationary_solve(S, solvers[k], 1e-7f, 5000, 0.8, pi, &info);
+        char label[96];
+        if (solvers[k] == STAT_POWER && power_fails) {
+            snprintf(label, sizeof(label), "%s ne converge pas",
+                     stationary_solver_name(solvers[k]));
+            check_int_equal(label, conv, 0, failures);
+            continue;
+        }
+        float err = 0.0f;
+        for (int i = 0; i < S->n; ++i) {
+            float d = pi[i] - ref[i];
+            if (d < 0) d = -d;
+            if (d > err) err = d;
+        }
+        snprintf(label, sizeof(label), "%-8s converge (%d it., résidu %.1e)",
+                 stationary_solver_name(solvers[k]), info.iters, info.residual);
+        check_int_equal(label, conv, 1, failures);
+        snprintf(label, sizeof(label), "%-8s écart max à la référence < %.0e",
+                 stationary_solver_name(solvers[k]), (double)tol);
+        check_int_equal(label, err < tol, 1, failures);
+    }
+    free(pi);
+}
+
+static void test_stationary_solvers(int *failures)
+{
+    // Deux états : pi = (2/7, 5/7)
+    const float two[4] = {0.5f, 0.5f, 0.2f, 0.8f};
+    const float two_ref[2] = {2.0f / 7.0f, 5.0f / 7.0f};
+    t_spmatrix S2 = sparse_from_dense(2, two);
+    check_solvers("TEST 7 : stationnaire à deux états", &S2, two_ref, 1e-5f, 0, failures);
+    spmx_free(&S2);
+
+    // Classe de période 2 : pi = (1/4, 1/2, 1/4), l'itération de la puissance
+    // oscille entre (1/6, 2/3, 1/6) et (1/3, 1/3, 1/3)
+    const float cyc[9] = {0, 1, 0, 0.5f, 0, 0.5f, 0, 1, 0};
+    const float cyc_ref[3] = {0.25f, 0.5f, 0.25f};
+    t_spmatrix S3 = sparse_from_dense(3, cyc);
+    check_solvers("TEST 8 : classe périodique (d=2)", &S3, cyc_ref, 1e-5f, 1, failures);
+    spmx_free(&S3);
+
+    // Presque décomposable : deux blocs {0,1} et {2,3} couplés par 1e-3
+    const float nd[16] = {
+        0.4985f, 0.5f,    0.0015f, 0.0f,
+        0.3f,    0.7f,    0.0f,    0.0f,
+        0.0f,    0.0f,    0.6f,    0.4f,
+        0.001f,  0.0f,    0.5f,    0.499f
+    };
+    t_spmatrix S4 = sparse_from_dense(4, nd);
+    float nd_ref[4];
+    stationary_gth(&S4, nd_ref, NULL);
+    check_solvers("TEST 9 : classe presque décomposable", &S4, nd_ref, 1e-4f, 1, failures);
+    spmx_free(&S4);
+
+    // Chaîne aléatoire : référence GTH
+    t_spmatrix SR = random_chain(300, 4, 7u);
+    float *ref = (float *)malloc((size_t)SR.n * sizeof(float));
+    t_solve_info info;
+    stationary_gth(&SR, ref, &info);
+    check_int_equal("GTH : résidu < 1e-6", info.residual < 1e-6, 1, failures);
+    check_solvers("TEST 10 : chaîne aléatoire irréductible", &SR, ref, 1e-5f, 0, failures);
+    free(ref);
+    spmx_free(&SR);
+
+    // Hors Markov (somme sortante 1.2) : la masse diverge ; power s'arrête
+    // au premier itéré non fini, non convergé, sans vecteur inf/NaN
+    printf("\n--- TEST 11 : classe à somme sortante > 1 (power) ---\n");
+    const float over[9] = {0.0f, 1.2f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f};
+    t_spmatrix SO = sparse_from_dense(3, over);
+    float po[3];
+    t_solve_info oinfo;
+    int oconv = stationary_solve(&SO, STAT_POWER, 0.01f, 100000, 0.8, po, &oinfo);
+    check_int_equal("Non convergé", oconv, 0, failures);
+    check_int_equal("Arrêt avant max_iter", oinfo.iters < 100000, 1, failures);
+    check_int_equal("Vecteur fini", isfinite(po[0]) && isfinite(po[1]) && isfinite(po[2]), 1, failures);
+    check_int_equal("Résidu fini", isfinite(oinfo.residual), 1, failures);
+    spmx_free(&SO);
+
+    t_stat_solver s;
+    check_int_equal("Nom de solveur inconnu refusé", stationary_solver_parse("lu", &s), -1, failures);
+    check_int_equal("Nom 'bicgstab' reconnu", stationary_solver_parse("bicgstab", &s) == 0 && s == STAT_BICGSTAB, 1, failures);
+}
+
 int main(void)
 {
     printf("=== TEST Partie 3.2 : stationary-analysis (subMatrix) ===\n");
@@ -194,6 +396,8 @@ int main(void)
     test_submatrix_unsorted_class(&failures);
     test_submatrix_invalid_index(&failures);
     test_submatrix_empty_class(&failures);
+    test_sparse_submatrix(&failures);
+    test_stationary_solvers(&failures);
 
     if (failures > 0) {
         printf("\n=> ❌ %d test(s) échoué(s).\n", failures);
@@ -6,14 +6,15 @@
 #include "scc.h"
 #include "tarjan.h"
 #include "io.h"
+#include "graph_gen.h"
 
 static void print_partition(const Partition *p) {
     printf("Partition (%d classes):\n", p->count);
     for (int i = 0; i < p->count; ++i) {
         printf("  C%d {", i + 1);
-        for (int j = 0; j < p->classes[i].count; ++j) {
+        for (int j = 0; j < scc_class(p, i).count; ++j) {
             if (j) putchar(',');
-            printf("%d", p->classes[i].verts[j]);
+            printf("%d", scc_class(p, i).verts[j]);
         }
         printf("}\n");
     }
@@ -24,6 +25,93 @@ static int cmp_int(const void *a, const void *b) {
     return (ia > ib) - (ia < ib);
 }
 
+// Retourne 1 si les deux partitions sont identiques (classes et ordre compris)
+static int same_partition(const Partition *a, const Partition *b) {
+    if (a->count != b->count) return 0;
+    for (int i = 0; i < a->count; ++i) {
+        if (scc_class(a, i).count != scc_class(b, i).count) return 0;
+        if (memcmp(scc_class(a, i).verts, scc_class(b, i).verts,
+                   (size_t)scc_class(a, i).count * sizeof(int)) != 0) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief  Vérifie la forme à plat (CSR) de la partition
+ *
+ * class_offsets croissant de 0 à N, chaque sommet 1..N présent une seule
+ * fois dans 'members' et class_of cohérent avec la classe qui le contient.
+ *
+ * @return  1 si cohérente, 0 sinon
+ */
+static int flat_layout_ok(const Partition *P, int n) {
+    if (P->count <= 0 || P->class_offsets[0] != 0 || P->class_offsets[P->count] != n
+        || P->n_members != n || P->class_of_len <= n) return 0;
+    int *seen = (int *)calloc((size_t)n + 1, sizeof(int));
+    if (!seen) return 0;
+    int ok = 1;
+    for (int k = 0; ok && k < P->count; ++k) {
+        SccClass c = scc_class(P, k);
+        if (c.count <= 0) ok = 0;
+        for (int j = 0; ok && j < c.count; ++j) {
+            int v = c.verts[j];
+            if (v < 1 || v > n || seen[v]++ || P->class_of[v] != k) ok = 0;
+        }
+    }
+    free(seen);
+    return ok;
+}
+
+/**
+ * @brief  Compare le Tarjan itératif à la version récursive
+ *
+ * Graphes pseudo-aléatoires de degrés 1 à 4 (nombreuses petites classes ou
+ * une grande classe), puis chaîne de 2 millions d'états, trop profonde pour
+ * la version récursive avec la pile par défaut.
+ *
+ * @return  Nombre d'écarts constatés
+ */
+static int check_iterative(void) {
+    int failures = 0;
+    for (int deg = 1; deg <= 4; ++deg) {
+        for (unsigned seed = 1; seed <= 5; ++seed) {
+            AdjList g;
+            gen_random(&g, 2000, deg, seed);
+            Partition it, rec;
+            scc_init_partition(&it);
+            scc_init_partition(&rec);
+            tarjan_partition(&g, &it);
+            tarjan_partition_recursive(&g, &rec);
+            if (!flat_layout_ok(&it, g.size)) {
+                printf("  [FAIL] partition à plat incohérente (degré %d, graine %u)\n", deg, seed);
+                failures++;
+            }
+            if (!same_partition(&it, &rec)) {
+                printf("  [FAIL] itératif != récursif (degré %d, graine %u)\n", deg, seed);
+                failures++;
+            }
+            scc_free_partition(&it);
+            scc_free_partition(&rec);
+            graph_free(&g);
+        }
+    }
+    printf("  [%s] Tarjan itératif identique au récursif, partition à plat cohérente (graphes aléatoires)\n",
+           failures ? "FAIL" : "OK");
+
+    const int n = 2000000;
+    AdjList chain;
+    gen_birth_death(&chain, n);
+    Partition P;
+    scc_init_partition(&P);
+    tarjan_partition(&chain, &P);
+    int ok = P.count == 1 && scc_class(&P, 0).count == n;
+    printf("  [%s] chaîne de %d états : %d classe(s)\n", ok ? "OK" : "FAIL", n, P.count);
+    if (!ok) failures++;
+    scc_free_partition(&P);
+    graph_free(&chain);
+    return failures;
+}
+
 int main(void) {
     printf("=== TEST Partie 2.1 : tarjan_core (SCC/partition) ===\n");
     AdjList g;
@@ -41,8 +129,8 @@ int main(void) {
     int class_of[9]; // 1..8
     memset(class_of, 0, sizeof(class_of));
     for (int k = 0; k < P.count; ++k) {
-        for (int j = 0; j < P.classes[k].count; ++j) {
-            int v = P.classes[k].verts[j];
+        for (int j = 0; j < scc_class(&P, k).count; ++j) {
+            int v = scc_class(&P, k).verts[j];
             if (v >= 1 && v <= 8) class_of[v] = k;
         }
     }
@@ -50,6 +138,12 @@ int main(void) {
     scc_free_partition(&P);
     graph_free(&g);
     printf("[OK] Partition Tarjan exécutée.\n");
+
+    printf("\n[Test] Tarjan itératif :\n");
+    if (check_iterative() > 0) {
+        printf("=> Tarjan itératif en échec.\n");
+        return EXIT_FAILURE;
+    }
     printf("=== FIN TEST tarjan_core ===\n");
     return 0;
 }
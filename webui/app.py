@@ -123,7 +123,7 @@ def index():
         out_graph=request.form.get("out_graph", DEFAULT_OUT_GRAPH),
         out_hasse=request.form.get("out_hasse", DEFAULT_OUT_HASSE),
         matrix_power=request.form.get("matrix_power", ""),
-        converge_max=request.form.get("converge_max", "30"),
+        converge_max=request.form.get("converge_max", ""),
         dist_start=request.form.get("dist_start", ""),
         dist_steps=request.form.get("dist_steps", ""),
         keep_transitive=request.form.get("keep_transitive") == "on",